@@ -0,0 +1,146 @@
+#include "BBoxMailbox.h"
+
+#include <QMutexLocker>
+
+/**
+ * @brief BBoxMailbox 생성자
+ */
+BBoxMailbox::BBoxMailbox()
+{
+    m_clock.start();
+}
+
+/**
+ * @brief 변경분 넣기
+ * @param cameraId 카메라 ID
+ * @param delta 변경분
+ * @param timestamp 타임스탬프
+ * @return 비어 있던 칸에 들어갔으면 true (호출 측이 화면에 알릴 시점)
+ */
+bool BBoxMailbox::post(const QString &cameraId, const BBoxDelta &delta, qint64 timestamp)
+{
+    QMutexLocker locker(&m_mutex);
+
+    m_stats.posted++;
+
+    auto it = m_slots.find(cameraId);
+    if (it == m_slots.end()) {
+        it = m_slots.insert(cameraId, Slot());
+    }
+
+    Slot &slot = *it;
+    const bool wasEmpty = slot.frames == 0;
+    if (wasEmpty) {
+        slot.firstPostedNs = m_clock.nsecsElapsed();
+    }
+    merge(slot, delta);
+    slot.timestamp = timestamp;
+    slot.frames++;
+    return wasEmpty;
+}
+
+/**
+ * @brief 합쳐진 변경분 꺼내기
+ * @param cameraId 카메라 ID
+ * @param delta 변경분 (출력)
+ * @param timestamp 마지막 프레임의 타임스탬프 (출력)
+ * @return 꺼낼 변경분이 있었으면 true
+ */
+bool BBoxMailbox::take(const QString &cameraId, BBoxDelta *delta, qint64 *timestamp)
+{
+    QMutexLocker locker(&m_mutex);
+
+    auto it = m_slots.find(cameraId);
+    if (it == m_slots.end() || it->frames == 0) {
+        return false;
+    }
+
+    const qint64 waitUs = (m_clock.nsecsElapsed() - it->firstPostedNs) / 1000;
+    m_stats.delivered++;
+    m_stats.dropped += it->frames - 1;
+    m_stats.totalWaitUs += waitUs;
+    m_stats.maxWaitUs = qMax(m_stats.maxWaitUs, waitUs);
+
+    *delta = std::move(it->delta);
+    *timestamp = it->timestamp;
+    m_slots.erase(it);
+    return true;
+}
+
+/**
+ * @brief 대기 중인 변경분 모두 버리기
+ */
+void BBoxMailbox::clear()
+{
+    QMutexLocker locker(&m_mutex);
+
+    for (const Slot &slot : std::as_const(m_slots)) {
+        m_stats.dropped += slot.frames;
+    }
+    m_slots.clear();
+}
+
+/**
+ * @brief 통계 반환
+ * @return 통계
+ */
+BBoxMailbox::Stats BBoxMailbox::stats() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_stats;
+}
+
+/**
+ * @brief 통계 초기화
+ */
+void BBoxMailbox::resetStats()
+{
+    QMutexLocker locker(&m_mutex);
+    m_stats = Stats();
+}
+
+/**
+ * @brief 대기 칸에 새 변경분 합치기
+ * @details 화면은 reset → removed → upserted 순으로 적용하므로, 같은 객체는 마지막 값만 남기고
+ *          중간에 사라진 객체는 대기 중인 추가/이동을 지운 뒤 제거 목록에 남깁니다.
+ * @param slot 대기 칸
+ * @param delta 새 변경분
+ */
+void BBoxMailbox::merge(Slot &slot, const BBoxDelta &delta)
+{
+    if (delta.reset) {
+        // 전체 초기화면 이전 변경분은 의미가 없음
+        slot.delta = delta;
+        slot.upsertIndex.clear();
+        for (int i = 0; i < slot.delta.upserted.size(); ++i) {
+            slot.upsertIndex.insert(slot.delta.upserted.at(i).object_id, i);
+        }
+        return;
+    }
+
+    for (int id : delta.removed) {
+        auto indexIt = slot.upsertIndex.find(id);
+        if (indexIt != slot.upsertIndex.end()) {
+            // 마지막 항목을 빈 자리로 옮겨 O(1)로 제거
+            const int index = indexIt.value();
+            slot.upsertIndex.erase(indexIt);
+            const int last = slot.delta.upserted.size() - 1;
+            if (index != last) {
+                slot.delta.upserted[index] = slot.delta.upserted.at(last);
+                slot.upsertIndex[slot.delta.upserted.at(index).object_id] = index;
+            }
+            slot.delta.upserted.removeLast();
+        }
+        slot.delta.removed.append(id);
+    }
+
+    for (const BBox &bbox : delta.upserted) {
+        auto indexIt = slot.upsertIndex.constFind(bbox.object_id);
+        if (indexIt != slot.upsertIndex.constEnd()) {
+            slot.delta.upserted[indexIt.value()] = bbox;
+        } else {
+            slot.upsertIndex.insert(bbox.object_id, slot.delta.upserted.size());
+            slot.delta.upserted.append(bbox);
+        }
+    }
+}
@@ -0,0 +1,91 @@
+#ifndef BBOXMAILBOX_H
+#define BBOXMAILBOX_H
+
+#include "BBoxTrackTable.h"
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QMutex>
+#include <QString>
+
+/**
+ * @brief 최신 값 우선 BBox 우편함
+ * @details 네트워크 스레드가 카메라별 BBox 변경분을 넣고, 화면 쪽이 표시 주기마다 한 번 꺼냅니다.
+ *          꺼내기 전에 새 프레임이 오면 기존 변경분 위에 합쳐 두고 지나간 프레임은 버린 것으로 집계하므로,
+ *          서버가 몰아서 보내도 화면에는 최신 상태 하나만 전달됩니다. 모든 함수는 스레드 안전합니다.
+ */
+class BBoxMailbox
+{
+public:
+    /**
+     * @brief 우편함 통계
+     */
+    struct Stats {
+        qint64 posted = 0;          // 들어온 프레임 수
+        qint64 delivered = 0;       // 화면에 전달한 묶음 수
+        qint64 dropped = 0;         // 합쳐지면서 버려진 프레임 수
+        qint64 maxWaitUs = 0;       // 첫 프레임 도착부터 전달까지 최대 대기 시간(us)
+        qint64 totalWaitUs = 0;     // 누적 대기 시간(us)
+    };
+
+    /**
+     * @brief BBoxMailbox 생성자
+     */
+    BBoxMailbox();
+
+    /**
+     * @brief 변경분 넣기
+     * @param cameraId 카메라 ID
+     * @param delta 변경분
+     * @param timestamp 타임스탬프
+     * @return 비어 있던 칸에 들어갔으면 true (호출 측이 화면에 알릴 시점)
+     */
+    bool post(const QString &cameraId, const BBoxDelta &delta, qint64 timestamp);
+    /**
+     * @brief 합쳐진 변경분 꺼내기
+     * @param cameraId 카메라 ID
+     * @param delta 변경분 (출력)
+     * @param timestamp 마지막 프레임의 타임스탬프 (출력)
+     * @return 꺼낼 변경분이 있었으면 true
+     */
+    bool take(const QString &cameraId, BBoxDelta *delta, qint64 *timestamp);
+    /**
+     * @brief 대기 중인 변경분 모두 버리기
+     */
+    void clear();
+    /**
+     * @brief 통계 반환
+     * @return 통계
+     */
+    Stats stats() const;
+    /**
+     * @brief 통계 초기화
+     */
+    void resetStats();
+
+private:
+    /**
+     * @brief 카메라별 대기 칸
+     */
+    struct Slot {
+        BBoxDelta delta;                // 합쳐진 변경분
+        QHash<int, int> upsertIndex;    // object_id → delta.upserted 인덱스
+        qint64 timestamp = 0;           // 마지막 프레임 타임스탬프
+        qint64 firstPostedNs = 0;       // 첫 프레임 도착 시각 (m_clock 기준)
+        int frames = 0;                 // 합쳐진 프레임 수
+    };
+
+    /** @brief 대기 칸에 새 변경분 합치기 */
+    static void merge(Slot &slot, const BBoxDelta &delta);
+
+    /** @brief 접근 보호 뮤텍스 */
+    mutable QMutex m_mutex;
+    /** @brief 카메라별 대기 칸 */
+    QHash<QString, Slot> m_slots;
+    /** @brief 대기 시간 측정용 시계 */
+    QElapsedTimer m_clock;
+    /** @brief 통계 */
+    Stats m_stats;
+};
+
+#endif // BBOXMAILBOX_H
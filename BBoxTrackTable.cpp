@@ -0,0 +1,153 @@
+#include "BBoxTrackTable.h"
+
+#include <QSet>
+
+/**
+ * @brief 두 BBox가 같은 값인지 비교
+ */
+static bool sameBBox(const BBox &a, const BBox &b)
+{
+    return a.rect == b.rect && a.type == b.type && qFuzzyCompare(a.confidence + 1.0, b.confidence + 1.0);
+}
+
+/**
+ * @brief BBox가 필터를 통과하는지 여부
+ * @param bbox BBox (원본 영상 좌표)
+ * @return 통과하면 true
+ */
+bool BBoxFilter::accepts(const BBox &bbox) const
+{
+    if (!classes.isEmpty() && !classes.contains(bbox.type)) {
+        return false;
+    }
+    if (bbox.confidence < minConfidence) {
+        return false;
+    }
+    return region.isEmpty() || region.intersects(bbox.rect);
+}
+
+/**
+ * @brief BBoxTrackTable 생성자
+ */
+BBoxTrackTable::BBoxTrackTable()
+    : m_synced(false)
+    , m_lastFrameSeq(-1)
+{
+}
+
+/**
+ * @brief 전체 프레임 적용
+ * @param bboxes 현재 화면의 전체 BBox
+ * @param frameSeq 프레임 순번 (없으면 -1)
+ * @return 변경분
+ */
+BBoxDelta BBoxTrackTable::applyFull(const QList<BBox> &bboxes, qint64 frameSeq)
+{
+    BBoxDelta delta;
+    QSet<int> seen;
+    seen.reserve(bboxes.size());
+
+    for (const BBox &bbox : bboxes) {
+        seen.insert(bbox.object_id);
+        auto it = m_tracks.find(bbox.object_id);
+        if (it == m_tracks.end()) {
+            m_tracks.insert(bbox.object_id, bbox);
+            delta.upserted.append(bbox);
+        } else if (!sameBBox(*it, bbox)) {
+            *it = bbox;
+            delta.upserted.append(bbox);
+        }
+    }
+
+    for (auto it = m_tracks.begin(); it != m_tracks.end();) {
+        if (!seen.contains(it.key())) {
+            delta.removed.append(it.key());
+            it = m_tracks.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    m_synced = true;
+    m_lastFrameSeq = frameSeq;
+    return delta;
+}
+
+/**
+ * @brief 델타 프레임 적용
+ * @param added 새 트랙
+ * @param updated 부분 갱신
+ * @param removed 제거된 트랙 ID
+ * @param frameSeq 프레임 순번 (없으면 -1)
+ * @param delta 적용된 변경분 (출력)
+ * @return 적용 여부
+ */
+bool BBoxTrackTable::applyDelta(const QList<BBox> &added, const QList<BBoxPatch> &updated, const QList<int> &removed,
+                                qint64 frameSeq, BBoxDelta *delta)
+{
+    if (!m_synced) {
+        return false;
+    }
+    if (frameSeq >= 0 && m_lastFrameSeq >= 0 && frameSeq != m_lastFrameSeq + 1) {
+        // 순번이 끊기면 다음 전체 프레임까지 델타를 버림
+        m_synced = false;
+        return false;
+    }
+    m_lastFrameSeq = frameSeq;
+
+    for (int id : removed) {
+        if (m_tracks.remove(id) > 0) {
+            delta->removed.append(id);
+        }
+    }
+
+    for (const BBox &bbox : added) {
+        m_tracks.insert(bbox.object_id, bbox);
+        delta->upserted.append(bbox);
+    }
+
+    for (const BBoxPatch &patch : updated) {
+        auto it = m_tracks.find(patch.object_id);
+        if (it == m_tracks.end()) {
+            // 알 수 없는 트랙의 부분 갱신은 값을 완성할 수 없으므로 무시
+            continue;
+        }
+
+        BBox &bbox = *it;
+        if (patch.fields & BBoxPatch::Type) {
+            bbox.type = patch.type;
+        }
+        if (patch.fields & BBoxPatch::Confidence) {
+            bbox.confidence = patch.confidence;
+        }
+        if (patch.fields & BBoxPatch::X) {
+            bbox.rect.moveLeft(patch.x);
+        }
+        if (patch.fields & BBoxPatch::Y) {
+            bbox.rect.moveTop(patch.y);
+        }
+        if (patch.fields & BBoxPatch::Width) {
+            bbox.rect.setWidth(patch.width);
+        }
+        if (patch.fields & BBoxPatch::Height) {
+            bbox.rect.setHeight(patch.height);
+        }
+        delta->upserted.append(bbox);
+    }
+
+    return true;
+}
+
+/**
+ * @brief 테이블 초기화
+ * @return 화면에서 모두 지우도록 하는 변경분 (비어 있었으면 빈 변경분)
+ */
+BBoxDelta BBoxTrackTable::clear()
+{
+    BBoxDelta delta;
+    delta.reset = !m_tracks.isEmpty();
+    m_tracks.clear();
+    m_synced = false;
+    m_lastFrameSeq = -1;
+    return delta;
+}
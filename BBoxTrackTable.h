@@ -0,0 +1,142 @@
+#ifndef BBOXTRACKTABLE_H
+#define BBOXTRACKTABLE_H
+
+#include <QHash>
+#include <QList>
+#include <QRect>
+#include <QString>
+
+#include "ObjectClass.h"
+
+/**
+ * @brief BBox 데이터 구조체
+ * @details 객체 ID, 타입, 신뢰도, 바운딩 박스 영역 포함
+ */
+struct BBox {
+    int object_id;          // 객체 ID
+    ObjectClass type;       // 객체 타입 (이름은 ObjectClassTable::name())
+    double confidence;      // 신뢰도 (0.0 ~ 1.0)
+    QRect rect;            // 바운딩 박스 영역 (x, y, width, height)
+};
+
+/**
+ * @brief BBox 부분 갱신 구조체
+ * @details 델타 스트림의 "updated" 항목. fields에 켜진 필드만 기존 트랙에 덮어씁니다.
+ */
+struct BBoxPatch {
+    /**
+     * @brief 갱신 필드 비트
+     */
+    enum Field {
+        Type = 0x01,
+        Confidence = 0x02,
+        X = 0x04,
+        Y = 0x08,
+        Width = 0x10,
+        Height = 0x20
+    };
+
+    int object_id = 0;      // 객체 ID
+    int fields = 0;         // 갱신 필드 (Field 조합)
+    ObjectClass type = ObjectClass::Unknown;
+    double confidence = 0.0;
+    int x = 0;
+    int y = 0;
+    int width = 0;
+    int height = 0;
+};
+
+/**
+ * @brief BBox 구독 필터
+ * @details BBox ON 요청(31)에 실어 서버가 그릴 BBox만 보내도록 하고, 구버전 서버가 필터를 무시해도
+ *          화면에는 같은 조건을 적용합니다.
+ */
+struct BBoxFilter {
+    QList<ObjectClass> classes;     // 표시할 클래스 (비었으면 전체)
+    double minConfidence = 0.0;     // 최소 신뢰도 (0.0 ~ 1.0)
+    QRect region;                   // 관심 영역 (원본 영상 좌표, 비었으면 전체)
+
+    /**
+     * @brief BBox가 필터를 통과하는지 여부
+     * @param bbox BBox (원본 영상 좌표)
+     * @return 통과하면 true
+     */
+    bool accepts(const BBox &bbox) const;
+};
+
+/**
+ * @brief BBox 변경분 구조체
+ * @details 화면 쪽은 reset이면 모두 지운 뒤, upserted는 추가/이동, removed는 제거만 하면 됩니다.
+ */
+struct BBoxDelta {
+    bool reset = false;         // 기존 BBox 전부 제거 후 적용
+    QList<BBox> upserted;       // 추가되었거나 바뀐 트랙 (전체 값)
+    QList<int> removed;         // 사라진 트랙 ID
+
+    /**
+     * @brief 변경분이 없는지 여부
+     * @return 비었으면 true
+     */
+    bool isEmpty() const { return !reset && upserted.isEmpty() && removed.isEmpty(); }
+};
+
+/**
+ * @brief object_id 기준 BBox 트랙 테이블
+ * @details 서버의 BBox 스트림(200)을 트랙 단위로 보관합니다. 전체 프레임은 기존 트랙과 비교해
+ *          변경분만 만들고, 델타 프레임은 제자리에서 적용하므로 처리 비용이 객체 수가 아닌
+ *          변경량에 비례합니다.
+ */
+class BBoxTrackTable
+{
+public:
+    /**
+     * @brief BBoxTrackTable 생성자
+     */
+    BBoxTrackTable();
+
+    /**
+     * @brief 전체 프레임 적용
+     * @details 테이블을 프레임 내용으로 교체하고, 기존 대비 변경분을 반환합니다.
+     * @param bboxes 현재 화면의 전체 BBox
+     * @param frameSeq 프레임 순번 (없으면 -1)
+     * @return 변경분
+     */
+    BBoxDelta applyFull(const QList<BBox> &bboxes, qint64 frameSeq = -1);
+    /**
+     * @brief 델타 프레임 적용
+     * @details 기준 전체 프레임이 없거나 순번이 끊기면 적용하지 않고 false를 반환합니다.
+     * @param added 새 트랙
+     * @param updated 부분 갱신
+     * @param removed 제거된 트랙 ID
+     * @param frameSeq 프레임 순번 (없으면 -1)
+     * @param delta 적용된 변경분 (출력)
+     * @return 적용 여부
+     */
+    bool applyDelta(const QList<BBox> &added, const QList<BBoxPatch> &updated, const QList<int> &removed,
+                    qint64 frameSeq, BBoxDelta *delta);
+    /**
+     * @brief 테이블 초기화
+     * @return 화면에서 모두 지우도록 하는 변경분 (비어 있었으면 빈 변경분)
+     */
+    BBoxDelta clear();
+    /**
+     * @brief 트랙 수 반환
+     * @return 트랙 수
+     */
+    int size() const { return m_tracks.size(); }
+    /**
+     * @brief 기준 전체 프레임 수신 여부
+     * @return 델타를 적용할 수 있으면 true
+     */
+    bool isSynced() const { return m_synced; }
+
+private:
+    /** @brief object_id별 트랙 */
+    QHash<int, BBox> m_tracks;
+    /** @brief 기준 전체 프레임 수신 여부 */
+    bool m_synced;
+    /** @brief 마지막 프레임 순번 (-1이면 순번 없음) */
+    qint64 m_lastFrameSeq;
+};
+
+#endif // BBOXTRACKTABLE_H
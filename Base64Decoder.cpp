@@ -0,0 +1,382 @@
+#include "Base64Decoder.h"
+
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define BASE64_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#else
+#define BASE64_X86 0
+#endif
+
+// GCC/Clang는 함수 단위로 명령어 집합을 켜고, MSVC는 표시 없이 내장 함수를 쓸 수 있음
+#if BASE64_X86 && !defined(_MSC_VER)
+#define BASE64_TARGET(isa) __attribute__((target(isa)))
+#else
+#define BASE64_TARGET(isa)
+#endif
+
+namespace {
+
+/**
+ * @brief 디코딩 경로
+ */
+enum class Backend {
+    Scalar,
+    Ssse3,
+    Avx2
+};
+
+/**
+ * @brief 문자 → 6비트 값 표 (표준 알파벳 외는 -1)
+ */
+struct DecodeTable {
+    signed char values[256];
+
+    constexpr DecodeTable() : values()
+    {
+        for (int i = 0; i < 256; ++i) {
+            values[i] = -1;
+        }
+        for (int i = 0; i < 26; ++i) {
+            values['A' + i] = static_cast<signed char>(i);
+            values['a' + i] = static_cast<signed char>(26 + i);
+        }
+        for (int i = 0; i < 10; ++i) {
+            values['0' + i] = static_cast<signed char>(52 + i);
+        }
+        values['+'] = 62;
+        values['/'] = 63;
+    }
+};
+
+constexpr DecodeTable kDecodeTable;
+
+/**
+ * @brief 실행 중인 CPU에 맞는 디코딩 경로 선택
+ * @return 디코딩 경로
+ */
+Backend detectBackend()
+{
+#if BASE64_X86 && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    const int maxLeaf = info[0];
+    __cpuid(info, 1);
+    const bool ssse3 = (info[2] & (1 << 9)) != 0;
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    // AVX2는 OS가 YMM 레지스터를 저장해 줄 때만 사용
+    if (maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 0x6) == 0x6) {
+        __cpuidex(info, 7, 0);
+        if (info[1] & (1 << 5)) {
+            return Backend::Avx2;
+        }
+    }
+    if (ssse3) {
+        return Backend::Ssse3;
+    }
+#elif BASE64_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return Backend::Avx2;
+    }
+    if (__builtin_cpu_supports("ssse3")) {
+        return Backend::Ssse3;
+    }
+#endif
+    return Backend::Scalar;
+}
+
+/**
+ * @brief 디코딩 경로 반환 (처음 한 번만 확인)
+ * @return 디코딩 경로
+ */
+Backend backend()
+{
+    static const Backend selected = detectBackend();
+    return selected;
+}
+
+/**
+ * @brief 스칼라 디코딩
+ * @details 패딩을 뺀 길이를 받으며, 끝의 2~3자 꼬리도 처리합니다.
+ * @param src 입력
+ * @param length 입력 길이 (length % 4 != 1)
+ * @param dst 출력
+ * @return 표준 알파벳 외 문자가 있으면 false
+ */
+bool decodeScalar(const uchar *src, qsizetype length, uchar *dst)
+{
+    const signed char *table = kDecodeTable.values;
+    qsizetype i = 0;
+    for (; i + 4 <= length; i += 4) {
+        const int a = table[src[i]];
+        const int b = table[src[i + 1]];
+        const int c = table[src[i + 2]];
+        const int d = table[src[i + 3]];
+        if ((a | b | c | d) < 0) {
+            return false;
+        }
+        const quint32 triple = (quint32(a) << 18) | (quint32(b) << 12) | (quint32(c) << 6) | quint32(d);
+        *dst++ = uchar(triple >> 16);
+        *dst++ = uchar(triple >> 8);
+        *dst++ = uchar(triple);
+    }
+
+    const qsizetype tail = length - i;
+    if (tail >= 2) {
+        const int a = table[src[i]];
+        const int b = table[src[i + 1]];
+        const int c = tail == 3 ? table[src[i + 2]] : 0;
+        if ((a | b | c) < 0) {
+            return false;
+        }
+        *dst++ = uchar((a << 2) | (b >> 4));
+        if (tail == 3) {
+            *dst++ = uchar(((b & 0x0F) << 4) | (c >> 2));
+        }
+    }
+    return true;
+}
+
+#if BASE64_X86
+
+/**
+ * @brief SSSE3 디코딩 (16자 → 12바이트씩)
+ * @details 상/하위 니블 표로 알파벳 밖 문자를 찾고, 상위 니블별 오프셋을 더해 6비트 값으로 바꾼 뒤
+ *          곱셈-덧셈 명령으로 4×6비트를 3바이트로 모읍니다. 매 블록 16바이트를 저장하므로
+ *          출력 끝을 넘지 않도록 24자 이상 남았을 때만 블록을 처리합니다.
+ * @param src 입력
+ * @param length 입력 길이 (패딩 제외)
+ * @param dst 출력
+ * @param consumed 처리한 입력 길이 (블록 단위)
+ * @return 표준 알파벳 외 문자가 있으면 false
+ */
+BASE64_TARGET("ssse3")
+bool decodeSsse3(const uchar *src, qsizetype length, uchar *dst, qsizetype &consumed)
+{
+    const __m128i lutLo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                        0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m128i lutHi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m128i lutRoll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71,
+                                          0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i mask2F = _mm_set1_epi8(0x2F);
+    const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+    qsizetype i = 0;
+    for (; length - i >= 24; i += 16, dst += 12) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+
+        const __m128i hiNibbles = _mm_and_si128(_mm_srli_epi32(in, 4), mask2F);
+        const __m128i loNibbles = _mm_and_si128(in, mask2F);
+        const __m128i lo = _mm_shuffle_epi8(lutLo, loNibbles);
+        const __m128i hi = _mm_shuffle_epi8(lutHi, hiNibbles);
+        if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128())) != 0) {
+            consumed = i;
+            return false;
+        }
+
+        const __m128i eq2F = _mm_cmpeq_epi8(in, mask2F);
+        const __m128i roll = _mm_shuffle_epi8(lutRoll, _mm_add_epi8(eq2F, hiNibbles));
+        in = _mm_add_epi8(in, roll);
+
+        const __m128i merged = _mm_maddubs_epi16(in, _mm_set1_epi32(0x01400140));
+        const __m128i out = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_shuffle_epi8(out, pack));
+    }
+    consumed = i;
+    return true;
+}
+
+/**
+ * @brief AVX2 디코딩 (32자 → 24바이트씩)
+ * @details SSSE3 경로와 같은 방식을 두 레인에서 수행한 뒤 레인 사이의 빈 4바이트를 당겨 붙입니다.
+ *          매 블록 32바이트를 저장하므로 48자 이상 남았을 때만 블록을 처리합니다.
+ * @param src 입력
+ * @param length 입력 길이 (패딩 제외)
+ * @param dst 출력
+ * @param consumed 처리한 입력 길이 (블록 단위)
+ * @return 표준 알파벳 외 문자가 있으면 false
+ */
+BASE64_TARGET("avx2")
+bool decodeAvx2(const uchar *src, qsizetype length, uchar *dst, qsizetype &consumed)
+{
+    const __m256i lutLo = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                           0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+                                           0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                           0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m256i lutHi = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                           0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                                           0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                           0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m256i lutRoll = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71,
+                                             0, 0, 0, 0, 0, 0, 0, 0,
+                                             0, 16, 19, 4, -65, -65, -71, -71,
+                                             0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i mask2F = _mm256_set1_epi8(0x2F);
+    const __m256i pack = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                          2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    const __m256i joinLanes = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, -1, -1);
+
+    qsizetype i = 0;
+    for (; length - i >= 48; i += 32, dst += 24) {
+        __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+
+        const __m256i hiNibbles = _mm256_and_si256(_mm256_srli_epi32(in, 4), mask2F);
+        const __m256i loNibbles = _mm256_and_si256(in, mask2F);
+        const __m256i lo = _mm256_shuffle_epi8(lutLo, loNibbles);
+        const __m256i hi = _mm256_shuffle_epi8(lutHi, hiNibbles);
+        if (!_mm256_testz_si256(lo, hi)) {
+            consumed = i;
+            return false;
+        }
+
+        const __m256i eq2F = _mm256_cmpeq_epi8(in, mask2F);
+        const __m256i roll = _mm256_shuffle_epi8(lutRoll, _mm256_add_epi8(eq2F, hiNibbles));
+        in = _mm256_add_epi8(in, roll);
+
+        const __m256i merged = _mm256_maddubs_epi16(in, _mm256_set1_epi32(0x01400140));
+        __m256i out = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+        out = _mm256_shuffle_epi8(out, pack);
+        out = _mm256_permutevar8x32_epi32(out, joinLanes);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), out);
+    }
+    consumed = i;
+    return true;
+}
+
+#endif // BASE64_X86
+
+} // namespace
+
+/**
+ * @brief base64 디코딩
+ * @param input base64 문자열 (data URL 접두사 없음)
+ * @param output 디코딩 결과 (실패 시 내용 미정)
+ * @return 표준 알파벳 외 문자나 잘못된 길이가 있으면 false
+ */
+bool Base64Decoder::decode(QByteArrayView input, QByteArray &output)
+{
+    const uchar *src = reinterpret_cast<const uchar *>(input.data());
+    qsizetype length = input.size();
+
+    // 패딩을 떼고 나면 SIMD 블록에는 알파벳 문자만 남음
+    if (length > 0 && length % 4 == 0 && src[length - 1] == '=') {
+        --length;
+        if (src[length - 1] == '=') {
+            --length;
+        }
+    }
+    if (length % 4 == 1) {
+        return false;
+    }
+
+    output.resize(length / 4 * 3 + (length % 4 ? length % 4 - 1 : 0));
+    uchar *dst = reinterpret_cast<uchar *>(output.data());
+    qsizetype consumed = 0;
+
+#if BASE64_X86
+    switch (backend()) {
+    case Backend::Avx2:
+        if (!decodeAvx2(src, length, dst, consumed)) {
+            return false;
+        }
+        break;
+    case Backend::Ssse3:
+        if (!decodeSsse3(src, length, dst, consumed)) {
+            return false;
+        }
+        break;
+    case Backend::Scalar:
+        break;
+    }
+#endif
+
+    return decodeScalar(src + consumed, length - consumed, dst + consumed / 4 * 3);
+}
+
+/**
+ * @brief 관대한 base64 디코딩
+ * @param input base64 문자열 (data URL 접두사 없음)
+ * @param output 디코딩 결과 (실패 시 내용 미정)
+ * @return 정리한 뒤에도 디코딩할 수 없으면 false
+ */
+bool Base64Decoder::decodeLenient(QByteArrayView input, QByteArray &output)
+{
+    if (decode(input, output)) {
+        return true;
+    }
+
+    // 정상 본문은 위에서 끝나므로 복사는 비정상 형식일 때만 발생
+    QByteArray normalized;
+    normalized.reserve(input.size());
+    for (qsizetype i = 0; i < input.size(); ++i) {
+        char c = input.at(i);
+        if (c == '\\') {
+            if (++i >= input.size()) {
+                return false;
+            }
+            c = input.at(i);
+            if (c == 'n' || c == 'r' || c == 't') {
+                continue;   // 줄바꿈 이스케이프
+            }
+            if (c == 'u') {
+                return false;   // base64 본문에 유니코드 이스케이프는 오지 않음
+            }
+            // "\/" → '/'
+        }
+        switch (c) {
+        case ' ':
+        case '\n':
+        case '\r':
+        case '\t':
+            continue;
+        case '-':
+            c = '+';
+            break;
+        case '_':
+            c = '/';
+            break;
+        default:
+            break;
+        }
+        normalized.append(c);
+    }
+    return decode(normalized, output);
+}
+
+/**
+ * @brief data URL 접두사 제거
+ * @param input base64 문자열
+ * @return 접두사를 뺀 뷰
+ */
+QByteArrayView Base64Decoder::stripDataUrlPrefix(QByteArrayView input)
+{
+    if (!input.startsWith("data:")) {
+        return input;
+    }
+    const char *comma = static_cast<const char *>(std::memchr(input.data(), ',', static_cast<size_t>(input.size())));
+    return comma ? input.sliced(comma - input.data() + 1) : input;
+}
+
+/**
+ * @brief 사용 중인 디코딩 경로 이름
+ * @return "avx2", "ssse3", "scalar" 중 하나
+ */
+const char *Base64Decoder::backendName()
+{
+    switch (backend()) {
+    case Backend::Avx2:
+        return "avx2";
+    case Backend::Ssse3:
+        return "ssse3";
+    case Backend::Scalar:
+        break;
+    }
+    return "scalar";
+}
@@ -0,0 +1,50 @@
+#ifndef BASE64DECODER_H
+#define BASE64DECODER_H
+
+#include <QByteArray>
+#include <QByteArrayView>
+
+/**
+ * @brief 이미지 본문용 base64 디코더
+ * @details 수신 프레임의 UTF-8 바이트를 QString으로 바꾸지 않고 그대로 디코딩합니다.
+ *          x86에서는 실행 중인 CPU에 맞춰 AVX2(32바이트) 또는 SSSE3(16바이트) 경로를 고르고,
+ *          그 밖의 환경과 남은 꼬리는 표 기반 스칼라 경로로 처리합니다.
+ *          decode()는 표준 알파벳만 받는 엄격한 디코더이며, decodeLenient()는 실패하면 본문을
+ *          정리해 같은 경로로 다시 디코딩합니다 (예: "\/" 이스케이프, 줄바꿈이 섞인 본문, base64url).
+ */
+class Base64Decoder
+{
+public:
+    /**
+     * @brief base64 디코딩
+     * @details 끝의 '=' 패딩은 있어도 없어도 됩니다.
+     * @param input base64 문자열 (data URL 접두사 없음)
+     * @param output 디코딩 결과 (실패 시 내용 미정)
+     * @return 표준 알파벳 외 문자나 잘못된 길이가 있으면 false
+     */
+    static bool decode(QByteArrayView input, QByteArray &output);
+    /**
+     * @brief 관대한 base64 디코딩
+     * @details 먼저 decode()로 시도하고, 실패하면 JSON 문자열 이스케이프("\/", "\n")와 공백/줄바꿈을
+     *          걷어 내고 base64url 문자('-', '_')를 표준 알파벳으로 바꾼 사본을 다시 디코딩합니다.
+     *          JSON 문자열 원문 범위를 그대로 넘겨도 됩니다.
+     * @param input base64 문자열 (data URL 접두사 없음)
+     * @param output 디코딩 결과 (실패 시 내용 미정)
+     * @return 정리한 뒤에도 디코딩할 수 없으면 false
+     */
+    static bool decodeLenient(QByteArrayView input, QByteArray &output);
+    /**
+     * @brief data URL 접두사 제거
+     * @details "data:image/jpeg;base64,..."이면 쉼표 뒤를 가리키는 뷰를 반환하며 복사하지 않습니다.
+     * @param input base64 문자열
+     * @return 접두사를 뺀 뷰
+     */
+    static QByteArrayView stripDataUrlPrefix(QByteArrayView input);
+    /**
+     * @brief 사용 중인 디코딩 경로 이름
+     * @return "avx2", "ssse3", "scalar" 중 하나
+     */
+    static const char *backendName();
+};
+
+#endif // BASE64DECODER_H
@@ -17,7 +17,20 @@ SOURCES += \
     TcpCommunicator.cpp \
     ImageViewerDialog.cpp \
     LineDrawingDialog.cpp \
-    EnvConfig.cpp
+    EnvConfig.cpp \
+    ChunkedRingBuffer.cpp \
+    ImageStreamDecoder.cpp \
+    OutboundQueue.cpp \
+    BBoxTrackTable.cpp \
+    BBoxMailbox.cpp \
+    ConnectionManager.cpp \
+    OfflineOutbox.cpp \
+    FrameSpillFile.cpp \
+    ImageCache.cpp \
+    FrameCodec.cpp \
+    ImageDecodePool.cpp \
+    Base64Decoder.cpp \
+    ObjectClass.cpp
 
 # 헤더 파일
 HEADERS += \
@@ -30,7 +43,21 @@ HEADERS += \
     LineDrawingDialog.h \
     EnvConfig.h \
     CustomMessageBox.h \
-    CustomTitleBar.h
+    CustomTitleBar.h \
+    ChunkedRingBuffer.h \
+    ImageStreamDecoder.h \
+    OutboundQueue.h \
+    BBoxTrackTable.h \
+    BBoxMailbox.h \
+    MessageFields.h \
+    ConnectionManager.h \
+    OfflineOutbox.h \
+    FrameSpillFile.h \
+    ImageCache.h \
+    FrameCodec.h \
+    ImageDecodePool.h \
+    Base64Decoder.h \
+    ObjectClass.h
 
 # 리소스 파일
 RESOURCES += resources.qrc
@@ -0,0 +1,136 @@
+#include "ChunkedRingBuffer.h"
+
+#include <cstring>
+
+/**
+ * @brief ChunkedRingBuffer 생성자
+ */
+ChunkedRingBuffer::ChunkedRingBuffer()
+    : m_readPos(0)
+    , m_size(0)
+{
+}
+
+/**
+ * @brief 청크 추가
+ * @param chunk 추가할 데이터
+ */
+void ChunkedRingBuffer::append(const QByteArray &chunk)
+{
+    if (chunk.isEmpty()) {
+        return;
+    }
+    m_chunks.append(chunk);
+    m_size += chunk.size();
+}
+
+/**
+ * @brief 소비하지 않고 앞쪽 데이터 복사
+ * @param data 복사 대상 버퍼
+ * @param maxLength 최대 길이
+ * @return 복사한 바이트 수
+ */
+qint64 ChunkedRingBuffer::peek(char *data, qint64 maxLength) const
+{
+    qint64 remaining = qMin(maxLength, m_size);
+    qint64 copied = 0;
+    qint64 offset = m_readPos;
+
+    for (const QByteArray &chunk : m_chunks) {
+        if (remaining <= 0) {
+            break;
+        }
+        qint64 available = chunk.size() - offset;
+        qint64 count = qMin(available, remaining);
+        std::memcpy(data + copied, chunk.constData() + offset, static_cast<size_t>(count));
+        copied += count;
+        remaining -= count;
+        offset = 0;
+    }
+
+    return copied;
+}
+
+/**
+ * @brief 앞쪽 데이터를 읽어 소비
+ * @param data 복사 대상 버퍼
+ * @param maxLength 최대 길이
+ * @return 읽은 바이트 수
+ */
+qint64 ChunkedRingBuffer::read(char *data, qint64 maxLength)
+{
+    qint64 copied = peek(data, maxLength);
+    skip(copied);
+    return copied;
+}
+
+/**
+ * @brief 앞쪽 데이터를 QByteArray로 읽어 소비
+ * @param length 읽을 길이
+ * @return 읽은 데이터
+ */
+QByteArray ChunkedRingBuffer::read(qint64 length)
+{
+    length = qMin(length, m_size);
+    if (length <= 0) {
+        return QByteArray();
+    }
+
+    const QByteArray &first = m_chunks.first();
+
+    // 프레임이 첫 청크 전체와 일치하면 복사 없이 반환
+    if (m_readPos == 0 && first.size() == length) {
+        QByteArray result = first;
+        m_chunks.removeFirst();
+        m_size -= length;
+        return result;
+    }
+
+    // 첫 청크 안에 들어가면 한 번만 복사
+    if (first.size() - m_readPos >= length) {
+        QByteArray result(first.constData() + m_readPos, length);
+        skip(length);
+        return result;
+    }
+
+    // 여러 청크에 걸치면 한 번 할당 후 조각 복사
+    QByteArray result;
+    result.resize(length);
+    read(result.data(), length);
+    return result;
+}
+
+/**
+ * @brief 앞쪽 데이터 버리기
+ * @param length 버릴 길이
+ * @return 버린 바이트 수
+ */
+qint64 ChunkedRingBuffer::skip(qint64 length)
+{
+    qint64 remaining = qMin(length, m_size);
+    qint64 skipped = remaining;
+
+    while (remaining > 0) {
+        qint64 available = m_chunks.first().size() - m_readPos;
+        if (remaining < available) {
+            m_readPos += remaining;
+            break;
+        }
+        remaining -= available;
+        m_chunks.removeFirst();
+        m_readPos = 0;
+    }
+
+    m_size -= skipped;
+    return skipped;
+}
+
+/**
+ * @brief 버퍼 초기화
+ */
+void ChunkedRingBuffer::clear()
+{
+    m_chunks.clear();
+    m_readPos = 0;
+    m_size = 0;
+}
@@ -0,0 +1,76 @@
+#ifndef CHUNKEDRINGBUFFER_H
+#define CHUNKEDRINGBUFFER_H
+
+#include <QByteArray>
+#include <QList>
+
+/**
+ * @brief 청크 기반 수신 링 버퍼
+ * @details 소켓에서 읽은 QByteArray 청크를 복사 없이 보관하고 읽기 커서로 소비합니다.
+ *          앞쪽 데이터를 remove()로 당기지 않으므로 프레임 하나당 복사는 최대 한 번입니다.
+ */
+class ChunkedRingBuffer
+{
+public:
+    /**
+     * @brief ChunkedRingBuffer 생성자
+     */
+    ChunkedRingBuffer();
+
+    /**
+     * @brief 청크 추가
+     * @param chunk 추가할 데이터 (암시적 공유로 보관, 복사 없음)
+     */
+    void append(const QByteArray &chunk);
+    /**
+     * @brief 읽지 않은 전체 바이트 수 반환
+     * @return 바이트 수
+     */
+    qint64 size() const { return m_size; }
+    /**
+     * @brief 버퍼가 비었는지 여부
+     * @return 비었으면 true
+     */
+    bool isEmpty() const { return m_size == 0; }
+    /**
+     * @brief 소비하지 않고 앞쪽 데이터 복사
+     * @param data 복사 대상 버퍼
+     * @param maxLength 최대 길이
+     * @return 복사한 바이트 수
+     */
+    qint64 peek(char *data, qint64 maxLength) const;
+    /**
+     * @brief 앞쪽 데이터를 읽어 소비
+     * @param data 복사 대상 버퍼
+     * @param maxLength 최대 길이
+     * @return 읽은 바이트 수
+     */
+    qint64 read(char *data, qint64 maxLength);
+    /**
+     * @brief 앞쪽 데이터를 QByteArray로 읽어 소비
+     * @details 요청 길이가 첫 청크 전체와 같으면 복사 없이 청크를 그대로 반환합니다.
+     * @param length 읽을 길이
+     * @return 읽은 데이터
+     */
+    QByteArray read(qint64 length);
+    /**
+     * @brief 앞쪽 데이터 버리기
+     * @param length 버릴 길이
+     * @return 버린 바이트 수
+     */
+    qint64 skip(qint64 length);
+    /**
+     * @brief 버퍼 초기화
+     */
+    void clear();
+
+private:
+    /** @brief 수신 청크 리스트 */
+    QList<QByteArray> m_chunks;
+    /** @brief 첫 청크 내 읽기 커서 */
+    qint64 m_readPos;
+    /** @brief 읽지 않은 전체 바이트 수 */
+    qint64 m_size;
+};
+
+#endif // CHUNKEDRINGBUFFER_H
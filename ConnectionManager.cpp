@@ -0,0 +1,385 @@
+#include "ConnectionManager.h"
+#include "EnvConfig.h"
+
+#include <QDebug>
+#include <QJsonObject>
+
+/**
+ * @brief ConnectionManager 생성자
+ * @param parent 부모 객체
+ */
+ConnectionManager::ConnectionManager(QObject *parent)
+    : QObject(parent)
+    , m_hasCredentials(false)
+    , m_otpLogin(false)
+{
+}
+
+/**
+ * @brief ConnectionManager 소멸자
+ * @details 사이트별 네트워크 스레드를 종료하고 통신기를 정리합니다.
+ */
+ConnectionManager::~ConnectionManager()
+{
+    // 모든 스레드에 먼저 종료를 요청한 뒤 기다려, 느린 사이트가 다른 사이트 종료를 늦추지 않도록 함
+    for (const Site &site : std::as_const(m_sites)) {
+        site.thread->quit();
+    }
+    for (const Site &site : std::as_const(m_sites)) {
+        site.thread->wait();
+    }
+}
+
+/**
+ * @brief .env에서 사이트 설정 읽기
+ * @param defaultEndpoints TCP_SITES가 없을 때 사용할 엔드포인트
+ * @param defaultPort 포트가 생략된 호스트의 기본 포트
+ * @return 사이트 설정 리스트 (첫 번째가 기본 사이트)
+ */
+QList<SiteConfig> ConnectionManager::sitesFromEnv(const QList<ServerEndpoint> &defaultEndpoints, quint16 defaultPort)
+{
+    QList<SiteConfig> sites;
+
+    const QStringList siteIds = EnvConfig::getValue("TCP_SITES", "").split(',', Qt::SkipEmptyParts);
+    for (const QString &rawId : siteIds) {
+        const QString siteId = rawId.trimmed();
+        if (siteId.isEmpty()) {
+            continue;
+        }
+
+        const QString prefix = QString("TCP_SITE_%1_").arg(siteId.toUpper());
+        SiteConfig config;
+        config.siteId = siteId;
+        config.endpoints = TcpCommunicator::parseServerEndpoints(EnvConfig::getValue(prefix + "HOSTS", ""), defaultPort);
+        if (config.endpoints.isEmpty()) {
+            qDebug() << "[ConnectionManager] 사이트" << siteId << "- 엔드포인트가 없어 제외 (" << prefix + "HOSTS" << ")";
+            continue;
+        }
+        for (const QString &cameraId : EnvConfig::getValue(prefix + "CAMERAS", "").split(',', Qt::SkipEmptyParts)) {
+            config.cameraIds.append(cameraId.trimmed());
+        }
+        sites.append(config);
+    }
+
+    // 다중 사이트 설정이 없으면 기존 TCP_HOSTS/TCP_HOST 단일 사이트
+    if (sites.isEmpty()) {
+        sites.append(SiteConfig{"default", defaultEndpoints, QStringList()});
+    }
+    return sites;
+}
+
+/**
+ * @brief 사이트 추가
+ * @param config 사이트 설정
+ * @return 사이트 통신기 (이미 있는 ID면 기존 통신기)
+ */
+TcpCommunicator *ConnectionManager::addSite(const SiteConfig &config)
+{
+    if (m_siteIndex.contains(config.siteId)) {
+        return m_sites.at(m_siteIndex.value(config.siteId)).communicator;
+    }
+
+    Site site;
+    site.config = config;
+    site.health.siteId = config.siteId;
+
+    // 사이트 전용 네트워크 스레드 (TLS/프레이밍/파싱이 다른 사이트와 GUI를 다투지 않도록)
+    site.thread = new QThread(this);
+    site.thread->setObjectName(QString("NetworkThread-%1").arg(config.siteId));
+    site.communicator = new TcpCommunicator();
+    site.communicator->moveToThread(site.thread);
+    // 스레드 종료 시 네트워크 스레드에서 정리
+    connect(site.thread, &QThread::finished, site.communicator, &QObject::deleteLater);
+
+    const QString siteId = config.siteId;
+    connect(site.communicator, &TcpCommunicator::connectionStateChanged, this,
+            [this, siteId](ConnectionState state, const QString &detail) {
+                onSiteStateChanged(siteId, state, detail);
+            });
+
+    site.thread->start();
+
+    m_siteIndex.insert(siteId, m_sites.size());
+    for (const QString &cameraId : config.cameraIds) {
+        m_cameraSites.insert(cameraId, siteId);
+    }
+    m_sites.append(site);
+
+    qDebug() << "[ConnectionManager] 사이트 추가 -" << siteId << "엔드포인트" << config.endpoints.size()
+             << "개, 카메라" << config.cameraIds.size() << "개";
+    return site.communicator;
+}
+
+/**
+ * @brief 사이트 ID 리스트 반환
+ * @return 추가된 순서의 사이트 ID
+ */
+QStringList ConnectionManager::siteIds() const
+{
+    QStringList ids;
+    ids.reserve(m_sites.size());
+    for (const Site &site : m_sites) {
+        ids.append(site.config.siteId);
+    }
+    return ids;
+}
+
+/**
+ * @brief 기본 사이트 ID 반환
+ * @return 첫 번째 사이트 ID (없으면 빈 문자열)
+ */
+QString ConnectionManager::primarySiteId() const
+{
+    return m_sites.isEmpty() ? QString() : m_sites.first().config.siteId;
+}
+
+/**
+ * @brief 기본 사이트 통신기 반환
+ * @return 통신기 (없으면 nullptr)
+ */
+TcpCommunicator *ConnectionManager::primaryCommunicator() const
+{
+    return m_sites.isEmpty() ? nullptr : m_sites.first().communicator;
+}
+
+/**
+ * @brief 사이트 설정 반환
+ * @param siteId 사이트 ID
+ * @return 사이트 설정 (없으면 빈 설정)
+ */
+SiteConfig ConnectionManager::siteConfig(const QString &siteId) const
+{
+    const auto it = m_siteIndex.constFind(siteId);
+    return it == m_siteIndex.constEnd() ? SiteConfig() : m_sites.at(it.value()).config;
+}
+
+/**
+ * @brief 사이트 통신기 반환
+ * @param siteId 사이트 ID
+ * @return 통신기 (없으면 nullptr)
+ */
+TcpCommunicator *ConnectionManager::communicator(const QString &siteId) const
+{
+    const auto it = m_siteIndex.constFind(siteId);
+    return it == m_siteIndex.constEnd() ? nullptr : m_sites.at(it.value()).communicator;
+}
+
+/**
+ * @brief 카메라가 속한 사이트 ID 반환
+ * @param cameraId 카메라 ID
+ * @return 사이트 ID (등록되지 않은 카메라면 기본 사이트)
+ */
+QString ConnectionManager::siteForCamera(const QString &cameraId) const
+{
+    return m_cameraSites.value(cameraId, primarySiteId());
+}
+
+/**
+ * @brief 카메라가 속한 사이트 통신기 반환
+ * @param cameraId 카메라 ID
+ * @return 통신기 (등록되지 않은 카메라면 기본 사이트 통신기)
+ */
+TcpCommunicator *ConnectionManager::communicatorForCamera(const QString &cameraId) const
+{
+    return communicator(siteForCamera(cameraId));
+}
+
+/**
+ * @brief 연결이 없는 사이트 모두 연결 시작
+ */
+void ConnectionManager::connectAll()
+{
+    for (const Site &site : std::as_const(m_sites)) {
+        ensureConnected(site.config.siteId);
+    }
+}
+
+/**
+ * @brief 사이트 하나 연결 시작 (끊겼거나 백오프 대기 중일 때만)
+ * @param siteId 사이트 ID
+ */
+void ConnectionManager::ensureConnected(const QString &siteId)
+{
+    const auto it = m_siteIndex.constFind(siteId);
+    if (it == m_siteIndex.constEnd()) {
+        return;
+    }
+
+    const Site &site = m_sites.at(it.value());
+    const ConnectionState state = site.communicator->connectionState();
+    if (state == ConnectionState::Disconnected || state == ConnectionState::BackingOff) {
+        qDebug() << "[ConnectionManager] 사이트" << siteId << "연결 시도";
+        site.communicator->connectToServers(site.config.endpoints);
+    }
+}
+
+/**
+ * @brief 로그인 성공 후 나머지 사이트 인증
+ * @param userId 사용자 ID
+ * @param password 비밀번호
+ * @param usedOtp OTP 인증을 거친 로그인 여부
+ */
+void ConnectionManager::authenticate(const QString &userId, const QString &password, bool usedOtp)
+{
+    m_userId = userId;
+    m_otpLogin = usedOtp;
+    // OTP 계정은 비밀번호만으로 인증되지 않으므로 보관하지 않음
+    m_password = usedOtp ? QString() : password;
+    m_hasCredentials = !usedOtp;
+
+    if (m_sites.isEmpty()) {
+        return;
+    }
+
+    // 기본 사이트는 로그인 창에서 인증 완료
+    m_sites.first().health.authenticated = true;
+    m_sites.first().health.authError.clear();
+
+    for (int i = 1; i < m_sites.size(); ++i) {
+        if (!m_sites.at(i).communicator->isConnectedToServer()) {
+            continue;
+        }
+        if (m_otpLogin) {
+            markAuthenticationFailed(m_sites.at(i).config.siteId, "OTP 계정은 자동 인증 불가");
+        } else {
+            authenticateSite(m_sites.at(i).config.siteId);
+        }
+    }
+}
+
+/**
+ * @brief 사이트별 연결 상태 반환
+ * @return 사이트 상태 리스트
+ */
+QList<SiteHealth> ConnectionManager::health() const
+{
+    QList<SiteHealth> result;
+    result.reserve(m_sites.size());
+    for (const Site &site : m_sites) {
+        result.append(site.health);
+    }
+    return result;
+}
+
+/**
+ * @brief 연결된 사이트 수 반환
+ * @return 사이트 수
+ */
+int ConnectionManager::connectedSiteCount() const
+{
+    int count = 0;
+    for (const Site &site : m_sites) {
+        if (site.health.state == ConnectionState::Connected) {
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief 사이트 연결 상태 변경 처리
+ * @param siteId 사이트 ID
+ * @param state 연결 상태
+ * @param detail 엔드포인트 또는 실패 사유
+ */
+void ConnectionManager::onSiteStateChanged(const QString &siteId, ConnectionState state, const QString &detail)
+{
+    const auto it = m_siteIndex.constFind(siteId);
+    if (it == m_siteIndex.constEnd()) {
+        return;
+    }
+
+    Site &site = m_sites[it.value()];
+    const bool wasConnected = site.health.state == ConnectionState::Connected;
+    site.health.state = state;
+    site.health.detail = detail;
+
+    const bool reconnected = state == ConnectionState::Connected && !wasConnected;
+    if (state != ConnectionState::Connected) {
+        // 서버 쪽 세션은 연결과 함께 사라지므로 재연결 시 다시 인증 (기본 사이트 포함)
+        site.health.authenticated = false;
+        site.health.authError.clear();
+    } else if (reconnected && m_hasCredentials) {
+        authenticateSite(siteId);
+    }
+
+    emit siteStateChanged(siteId, state, detail);
+
+    if (reconnected && m_otpLogin) {
+        // OTP 입력 없이는 인증할 수 없으므로 자동 재로그인하지 않고 알리기만 함
+        markAuthenticationFailed(siteId, "OTP 계정은 자동 재인증 불가 - 다시 로그인 필요");
+    }
+
+    if (wasConnected != (state == ConnectionState::Connected)) {
+        const int connected = connectedSiteCount();
+        qDebug() << QString("[ConnectionManager] 사이트 %1 %2 - 전체 %3/%4 연결")
+                        .arg(siteId, state == ConnectionState::Connected ? "연결됨" : "끊김")
+                        .arg(connected).arg(m_sites.size());
+        emit healthChanged(connected, m_sites.size());
+    }
+}
+
+/**
+ * @brief 사이트 하나 인증 (로그인 요청 8)
+ * @param siteId 사이트 ID
+ */
+void ConnectionManager::authenticateSite(const QString &siteId)
+{
+    TcpCommunicator *siteCommunicator = communicator(siteId);
+    if (!siteCommunicator || !m_hasCredentials) {
+        return;
+    }
+
+    // 로그인 요청 JSON 생성 (request_id: 8)
+    QJsonObject loginMessage;
+    loginMessage["request_id"] = 8;
+
+    QJsonObject data;
+    data["id"] = m_userId;
+    data["passwd"] = m_password;
+    loginMessage["data"] = data;
+
+    siteCommunicator->sendRequest(loginMessage)
+        .then(this, [this, siteId](TcpResponse response) {
+            const auto it = m_siteIndex.constFind(siteId);
+            if (it == m_siteIndex.constEnd()) {
+                return;
+            }
+
+            QString reason;
+            if (!response.success) {
+                reason = response.timedOut ? "응답 시간 초과" : response.error;
+            } else if (response.payload["step1_success"].toInt() == 0) {
+                reason = response.payload["message"].toString("로그인 실패");
+            } else if (response.payload["requires_otp"].toInt(0) == 1) {
+                // OTP는 사용자 입력이 필요하므로 재연결/보조 사이트에서는 자동 인증 불가
+                reason = "OTP 인증 필요";
+            }
+
+            if (reason.isEmpty()) {
+                m_sites[it.value()].health.authenticated = true;
+                m_sites[it.value()].health.authError.clear();
+                qDebug() << "[ConnectionManager] 사이트" << siteId << "인증 완료 - 지연:" << response.latencyMs << "ms";
+            } else {
+                markAuthenticationFailed(siteId, reason);
+            }
+        });
+}
+
+/**
+ * @brief 사이트 인증 실패 기록 및 알림
+ * @param siteId 사이트 ID
+ * @param reason 실패 사유
+ */
+void ConnectionManager::markAuthenticationFailed(const QString &siteId, const QString &reason)
+{
+    const auto it = m_siteIndex.constFind(siteId);
+    if (it == m_siteIndex.constEnd()) {
+        return;
+    }
+
+    m_sites[it.value()].health.authenticated = false;
+    m_sites[it.value()].health.authError = reason;
+    qDebug() << "[ConnectionManager] 사이트" << siteId << "인증 실패 -" << reason;
+    emit siteAuthenticationFailed(siteId, reason);
+}
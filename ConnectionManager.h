@@ -0,0 +1,207 @@
+#ifndef CONNECTIONMANAGER_H
+#define CONNECTIONMANAGER_H
+
+#include "TcpCommunicator.h"
+
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QThread>
+
+/**
+ * @brief 사이트(교차로) 백엔드 설정
+ */
+struct SiteConfig {
+    QString siteId;                     // 사이트 ID
+    QList<ServerEndpoint> endpoints;    // 페일오버 순서의 엔드포인트
+    QStringList cameraIds;              // 이 사이트에 속한 카메라 ID
+};
+
+/**
+ * @brief 사이트 연결 상태 요약
+ */
+struct SiteHealth {
+    QString siteId;                     // 사이트 ID
+    ConnectionState state = ConnectionState::Disconnected;  // 연결 상태
+    QString detail;                     // 엔드포인트 또는 실패 사유
+    bool authenticated = false;         // 인증 완료 여부
+    QString authError;                  // 마지막 인증 실패 사유 (인증되면 비움)
+};
+
+/**
+ * @brief 다중 사이트 연결 관리자
+ * @details 사이트마다 TcpCommunicator 하나와 전용 네트워크 스레드를 두어, 한 사이트의 TLS
+ *          핸드셰이크나 재연결 백오프, 대용량 응답 처리가 다른 사이트를 막지 않도록 합니다.
+ *          요청은 사이트 ID 또는 카메라 ID로 해당 통신기를 찾아 보냅니다. 첫 번째 사이트는
+ *          로그인 창이 직접 인증하는 기본 사이트이고, 나머지 사이트는 로그인 성공 후 같은
+ *          자격 증명으로 인증합니다. 모든 사이트는 재연결될 때마다 다시 인증합니다. OTP 계정은
+ *          사용자 입력 없이 인증할 수 없으므로 자동 인증하지 않고 인증 실패로만 알립니다.
+ */
+class ConnectionManager : public QObject
+{
+    Q_OBJECT
+public:
+    /**
+     * @brief ConnectionManager 생성자
+     * @param parent 부모 객체
+     */
+    explicit ConnectionManager(QObject *parent = nullptr);
+    /**
+     * @brief ConnectionManager 소멸자
+     * @details 사이트별 네트워크 스레드를 종료하고 통신기를 정리합니다.
+     */
+    ~ConnectionManager() override;
+
+    /**
+     * @brief .env에서 사이트 설정 읽기
+     * @details TCP_SITES=site1,site2 가 있으면 사이트마다 TCP_SITE_<ID>_HOSTS(host:port,...)와
+     *          TCP_SITE_<ID>_CAMERAS(cam1,cam2)를 읽고, 없으면 기본 엔드포인트로 단일 사이트를 만듭니다.
+     * @param defaultEndpoints TCP_SITES가 없을 때 사용할 엔드포인트
+     * @param defaultPort 포트가 생략된 호스트의 기본 포트
+     * @return 사이트 설정 리스트 (첫 번째가 기본 사이트)
+     */
+    static QList<SiteConfig> sitesFromEnv(const QList<ServerEndpoint> &defaultEndpoints, quint16 defaultPort);
+
+    /**
+     * @brief 사이트 추가
+     * @details 통신기를 만들어 사이트 전용 네트워크 스레드로 옮깁니다. 연결은 시작하지 않습니다.
+     * @param config 사이트 설정
+     * @return 사이트 통신기 (이미 있는 ID면 기존 통신기)
+     */
+    TcpCommunicator *addSite(const SiteConfig &config);
+    /**
+     * @brief 사이트가 없는지 여부
+     * @return 없으면 true
+     */
+    bool isEmpty() const { return m_sites.isEmpty(); }
+    /**
+     * @brief 사이트 ID 리스트 반환
+     * @return 추가된 순서의 사이트 ID
+     */
+    QStringList siteIds() const;
+    /**
+     * @brief 기본 사이트 ID 반환
+     * @return 첫 번째 사이트 ID (없으면 빈 문자열)
+     */
+    QString primarySiteId() const;
+    /**
+     * @brief 기본 사이트 통신기 반환
+     * @return 통신기 (없으면 nullptr)
+     */
+    TcpCommunicator *primaryCommunicator() const;
+    /**
+     * @brief 사이트 설정 반환
+     * @param siteId 사이트 ID
+     * @return 사이트 설정 (없으면 빈 설정)
+     */
+    SiteConfig siteConfig(const QString &siteId) const;
+    /**
+     * @brief 사이트 통신기 반환
+     * @param siteId 사이트 ID
+     * @return 통신기 (없으면 nullptr)
+     */
+    TcpCommunicator *communicator(const QString &siteId) const;
+    /**
+     * @brief 카메라가 속한 사이트 ID 반환
+     * @param cameraId 카메라 ID
+     * @return 사이트 ID (등록되지 않은 카메라면 기본 사이트)
+     */
+    QString siteForCamera(const QString &cameraId) const;
+    /**
+     * @brief 카메라가 속한 사이트 통신기 반환
+     * @param cameraId 카메라 ID
+     * @return 통신기 (등록되지 않은 카메라면 기본 사이트 통신기)
+     */
+    TcpCommunicator *communicatorForCamera(const QString &cameraId) const;
+
+    /**
+     * @brief 연결이 없는 사이트 모두 연결 시작
+     * @details 연결 중/핸드셰이크 중인 사이트는 그대로 두고, 각 사이트는 독립적으로 재연결합니다.
+     */
+    void connectAll();
+    /**
+     * @brief 사이트 하나 연결 시작 (끊겼거나 백오프 대기 중일 때만)
+     * @param siteId 사이트 ID
+     */
+    void ensureConnected(const QString &siteId);
+    /**
+     * @brief 로그인 성공 후 나머지 사이트 인증
+     * @details 기본 사이트는 로그인 창이 이미 인증했으므로 인증 완료로 표시하고, 나머지 사이트에
+     *          로그인 요청(8)을 보냅니다. 자격 증명은 메모리에만 보관하며, 기본 사이트를 포함한 모든
+     *          사이트가 재연결될 때마다 다시 인증하는 데 씁니다. OTP로 로그인했으면 저장한 비밀번호만으로는
+     *          인증되지 않으므로 자격 증명을 보관하지 않고, 나머지 사이트와 재연결된 사이트는 인증 실패로
+     *          표시합니다 (다시 로그인해야 함).
+     * @param userId 사용자 ID
+     * @param password 비밀번호
+     * @param usedOtp OTP 인증을 거친 로그인 여부
+     */
+    void authenticate(const QString &userId, const QString &password, bool usedOtp = false);
+
+    /**
+     * @brief 사이트별 연결 상태 반환
+     * @return 사이트 상태 리스트
+     */
+    QList<SiteHealth> health() const;
+    /**
+     * @brief 연결된 사이트 수 반환
+     * @return 사이트 수
+     */
+    int connectedSiteCount() const;
+
+signals:
+    /** @brief 사이트 연결 상태 변경 */
+    void siteStateChanged(const QString &siteId, ConnectionState state, const QString &detail);
+    /** @brief 전체 연결 상태 변경 (연결된 사이트 수 / 전체 사이트 수) */
+    void healthChanged(int connectedSites, int totalSites);
+    /** @brief 사이트 인증 실패 */
+    void siteAuthenticationFailed(const QString &siteId, const QString &reason);
+
+private:
+    /**
+     * @brief 사이트 연결 정보
+     */
+    struct Site {
+        SiteConfig config;              // 사이트 설정
+        QThread *thread = nullptr;      // 전용 네트워크 스레드
+        TcpCommunicator *communicator = nullptr;    // 통신기 (thread 소속)
+        SiteHealth health;              // 현재 상태
+    };
+
+    /**
+     * @brief 사이트 연결 상태 변경 처리
+     * @param siteId 사이트 ID
+     * @param state 연결 상태
+     * @param detail 엔드포인트 또는 실패 사유
+     */
+    void onSiteStateChanged(const QString &siteId, ConnectionState state, const QString &detail);
+    /**
+     * @brief 사이트 하나 인증 (로그인 요청 8)
+     * @param siteId 사이트 ID
+     */
+    void authenticateSite(const QString &siteId);
+    /**
+     * @brief 사이트 인증 실패 기록 및 알림
+     * @param siteId 사이트 ID
+     * @param reason 실패 사유
+     */
+    void markAuthenticationFailed(const QString &siteId, const QString &reason);
+
+    /** @brief 추가된 순서의 사이트 */
+    QList<Site> m_sites;
+    /** @brief 사이트 ID → m_sites 인덱스 */
+    QHash<QString, int> m_siteIndex;
+    /** @brief 카메라 ID → 사이트 ID */
+    QHash<QString, QString> m_cameraSites;
+    /** @brief 사이트 인증용 사용자 ID */
+    QString m_userId;
+    /** @brief 사이트 인증용 비밀번호 */
+    QString m_password;
+    /** @brief 자격 증명 보유 여부 */
+    bool m_hasCredentials;
+    /** @brief OTP 로그인 여부 (자동 인증 불가) */
+    bool m_otpLogin;
+};
+
+#endif // CONNECTIONMANAGER_H
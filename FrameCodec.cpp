@@ -0,0 +1,357 @@
+#include "FrameCodec.h"
+
+#include <QDebug>
+#include <QtEndian>
+
+/**
+ * @brief FrameCodec 생성자
+ */
+FrameCodec::FrameCodec()
+    : m_expectedFrameLength(0)
+    , m_frameLengthReceived(false)
+    , m_frameCompressed(false)
+    , m_streamingFrame(false)
+    , m_spillingFrame(false)
+    , m_frameBytesRemaining(0)
+    , m_error(false)
+    , m_generation(0)
+    , m_deliveringSpilledFrame(false)
+    , m_streamingThresholdBytes(256 * 1024)
+    , m_maxInMemoryBytes(32 * 1024 * 1024)
+    , m_maxFrameBytes(1024 * 1024 * 1024)
+{
+    // 이미지 한 장이 메모리 상한을 넘으면 디코더가 보관하지 않음
+    m_imageStreamDecoder.setMaxElementBytes(m_maxInMemoryBytes);
+}
+
+/**
+ * @brief 프레임 크기 상한 설정
+ * @param maxInMemoryBytes 메모리 상한(바이트)
+ * @param maxFrameBytes 절대 상한(바이트)
+ */
+void FrameCodec::setLimits(qint64 maxInMemoryBytes, qint64 maxFrameBytes)
+{
+    if (maxInMemoryBytes <= 0 || maxFrameBytes <= 0) {
+        return;
+    }
+    m_maxInMemoryBytes = maxInMemoryBytes;
+    m_maxFrameBytes = qMax(maxFrameBytes, maxInMemoryBytes);
+    m_imageStreamDecoder.setMaxElementBytes(m_maxInMemoryBytes);
+}
+
+/**
+ * @brief 수신 조각 입력
+ * @param chunk 수신 조각 (암시적 공유로 보관, 복사 없음)
+ * @return 이번 호출에서 완료한 프레임 수
+ */
+int FrameCodec::feed(const QByteArray &chunk)
+{
+    if (m_error) {
+        return 0;
+    }
+    if (!chunk.isEmpty()) {
+        m_buffer.append(chunk);
+    }
+
+    // 처리기 안에서 reset()되면 (연결 해제 등) 남은 바이트는 이전 연결의 것이므로 즉시 중단
+    const quint64 generation = m_generation;
+    int frames = 0;
+
+    while (!m_error && generation == m_generation) {
+        // Step 1: Read message length (4 bytes)
+        if (!m_frameLengthReceived) {
+            if (m_buffer.size() < 4) {
+                // Length information has not fully arrived
+                break;
+            }
+            if (!beginFrame()) {
+                break;
+            }
+        }
+
+        // Step 2-S: 임시 파일 프레임은 받은 만큼 파일에 쓰고 매핑에서 디코딩
+        if (m_spillingFrame) {
+            if (!feedSpilledFrame() || generation != m_generation || m_frameBytesRemaining > 0) {
+                break;
+            }
+            finishSpilledFrame();
+            ++frames;
+            continue;
+        }
+
+        // Step 2-A: 스트리밍 프레임은 받은 만큼 바로 디코딩
+        if (m_streamingFrame) {
+            feedStreamingFrame();
+            if (generation != m_generation || m_frameBytesRemaining > 0) {
+                break;
+            }
+            finishStreamingFrame();
+            ++frames;
+            continue;
+        }
+
+        // Step 2-B: Read the actual message data
+        if (m_buffer.size() < m_expectedFrameLength) {
+            // The message has not fully arrived
+            qDebug() << "[TCP] Waiting for message... Current:" << m_buffer.size() << "/ Required:" << m_expectedFrameLength;
+            break;
+        }
+
+        // Extract the complete message (최대 1회 복사)
+        const QByteArray payload = m_buffer.read(m_expectedFrameLength);
+        const bool compressed = m_frameCompressed;
+        endFrame();
+
+        qDebug() << "[TCP] Complete message received:" << payload.size() << "bytes";
+        ++frames;
+        if (m_frameHandler) {
+            m_frameHandler(payload, compressed);
+        }
+    }
+
+    return frames;
+}
+
+/**
+ * @brief 디코딩 상태 초기화 (새 연결)
+ * @details 새 연결에서 이전 연결의 잔여 바이트가 섞이지 않도록 버퍼를 비웁니다.
+ */
+void FrameCodec::reset()
+{
+    m_buffer.clear();
+    m_imageStreamDecoder.reset();
+    // 처리기가 아직 매핑 뷰를 쓰는 중이면 전달이 끝난 뒤 finishSpilledFrame()에서 삭제
+    if (!m_deliveringSpilledFrame) {
+        m_spillFile.release();
+    }
+    m_expectedFrameLength = 0;
+    m_frameLengthReceived = false;
+    m_frameCompressed = false;
+    m_streamingFrame = false;
+    m_spillingFrame = false;
+    m_frameBytesRemaining = 0;
+    m_error = false;
+    ++m_generation;
+}
+
+/**
+ * @brief 프레임 인코딩
+ * @param payload 페이로드 (compressed면 qCompress 결과)
+ * @param compressed 압축 표시 비트 설정 여부
+ * @return 전송할 프레임
+ */
+QByteArray FrameCodec::encode(const QByteArray &payload, bool compressed)
+{
+    quint32 lengthField = static_cast<quint32>(payload.size());
+    if (compressed) {
+        lengthField |= FrameCompressedFlag;
+    }
+
+    // 길이(4바이트, 빅엔디안) + 데이터를 하나의 버퍼로 구성
+    QByteArray frame;
+    frame.reserve(4 + payload.size());
+    frame.resize(4);
+    qToBigEndian<quint32>(lengthField, frame.data());
+    frame.append(payload);
+    return frame;
+}
+
+/**
+ * @brief 길이 헤더를 읽고 수신 경로 결정
+ * @return 성공 여부 (false면 오류)
+ */
+bool FrameCodec::beginFrame()
+{
+    // Extract length information
+    uchar lengthBytes[4];
+    m_buffer.read(reinterpret_cast<char *>(lengthBytes), 4);
+    const quint32 lengthField = qFromBigEndian<quint32>(lengthBytes);
+    m_frameCompressed = (lengthField & FrameCompressedFlag) != 0;
+    m_expectedFrameLength = lengthField & ~FrameCompressedFlag;
+    m_frameLengthReceived = true;
+
+    qDebug() << "[TCP] Message length received:" << m_expectedFrameLength << "bytes"
+             << (m_frameCompressed ? "(compressed)" : "");
+
+    // 손상된 헤더나 비정상 응답으로 거대한 할당이 일어나지 않도록 절대 상한 확인
+    if (m_expectedFrameLength > m_maxFrameBytes) {
+        qDebug() << "[TCP] 프레임 거부 - 길이" << m_expectedFrameLength << "바이트가 상한"
+                 << m_maxFrameBytes << "바이트 초과, 연결 재설정";
+        fail(QString("Frame too large (%1 bytes).").arg(m_expectedFrameLength));
+        return false;
+    }
+
+    // 메모리 상한을 넘는 프레임은 임시 파일에 쓰고 매핑에서 디코딩
+    if (m_expectedFrameLength > m_maxInMemoryBytes) {
+        // 압축 프레임은 전체를 메모리에서 해제해야 하므로 상한을 넘으면 받지 않음
+        if (m_frameCompressed) {
+            qDebug() << "[TCP] 프레임 거부 - 압축 프레임" << m_expectedFrameLength << "바이트가 메모리 상한"
+                     << m_maxInMemoryBytes << "바이트 초과, 연결 재설정";
+            fail(QString("Compressed frame too large (%1 bytes).").arg(m_expectedFrameLength));
+            return false;
+        }
+        if (!m_spillFile.begin(m_expectedFrameLength)) {
+            fail("Failed to buffer large frame.");
+            return false;
+        }
+        qDebug() << "[TCP] 대용량 프레임 - 임시 파일로 수신:" << m_expectedFrameLength << "바이트";
+        m_spillingFrame = true;
+        m_frameBytesRemaining = m_expectedFrameLength;
+        m_imageStreamDecoder.begin();
+    } else if (!m_frameCompressed && m_expectedFrameLength >= m_streamingThresholdBytes) {
+        // 대용량 프레임은 도착하는 대로 스트리밍 디코더에 전달 (압축 프레임은 전체 수신 후 해제)
+        m_streamingFrame = true;
+        m_frameBytesRemaining = m_expectedFrameLength;
+        m_imageStreamDecoder.begin();
+    }
+    return true;
+}
+
+/**
+ * @brief 임시 파일 프레임 수신
+ * @return 성공 여부 (false면 오류)
+ */
+bool FrameCodec::feedSpilledFrame()
+{
+    const qint64 available = qMin<qint64>(m_buffer.size(), m_frameBytesRemaining);
+    if (available <= 0) {
+        return true;
+    }
+
+    const qint64 offset = m_spillFile.written();
+    if (!m_spillFile.append(m_buffer.read(available))) {
+        fail("Failed to buffer large frame.");
+        return false;
+    }
+    m_frameBytesRemaining -= static_cast<quint32>(available);
+
+    // 매핑 구간을 디코더에 전달 (이미지 응답이면 원소 단위로 방출되어 디코더 버퍼는 원소 하나 크기)
+    const quint64 generation = m_generation;
+    m_imageStreamDecoder.feed(m_spillFile.view(offset, available));
+    emitImageElements();
+    if (generation != m_generation) {
+        return true;
+    }
+
+    // 원소 단위로 나눌 수 없는 프레임(CBOR, 다른 메시지)이나 메시지 ID 확인 전 상한을 넘은 프레임은
+    // 처리하려면 전체를 메모리에 올려야 하므로 받지 않음
+    if (m_imageStreamDecoder.mode() == ImageStreamDecoder::Mode::Passthrough
+        || (m_imageStreamDecoder.mode() == ImageStreamDecoder::Mode::Sniffing
+            && m_imageStreamDecoder.bufferedBytes() > m_maxInMemoryBytes)) {
+        qDebug() << "[TCP] 프레임 거부 - 스트리밍할 수 없는" << m_expectedFrameLength << "바이트 프레임이 메모리 상한"
+                 << m_maxInMemoryBytes << "바이트 초과, 연결 재설정";
+        fail(QString("Frame too large to decode (%1 bytes).").arg(m_expectedFrameLength));
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief 스트리밍 프레임 수신
+ */
+void FrameCodec::feedStreamingFrame()
+{
+    const qint64 available = qMin<qint64>(m_buffer.size(), m_frameBytesRemaining);
+    if (available <= 0) {
+        return;
+    }
+    m_imageStreamDecoder.feed(m_buffer.read(available));
+    m_frameBytesRemaining -= static_cast<quint32>(available);
+    emitImageElements();
+}
+
+/**
+ * @brief 스트리밍 디코더에서 완성된 이미지 원소 전달
+ * @details 이미지 응답으로 확인된 프레임의 data[] 원소를 도착 순서대로 넘깁니다.
+ */
+void FrameCodec::emitImageElements()
+{
+    if (!m_imageStreamDecoder.isStreaming()) {
+        return;
+    }
+
+    const QList<QByteArray> elements = m_imageStreamDecoder.takeElements();
+    if (m_imageElementsHandler) {
+        m_imageElementsHandler(elements);
+    }
+}
+
+/**
+ * @brief 스트리밍 프레임 종료 처리
+ */
+void FrameCodec::finishStreamingFrame()
+{
+    m_streamingFrame = false;
+
+    if (m_imageStreamDecoder.isStreaming()) {
+        const quint64 generation = m_generation;
+        emitImageElements();
+        if (generation != m_generation) {
+            return;
+        }
+
+        const QJsonObject fields = m_imageStreamDecoder.topLevelFields();
+        const int skippedElements = m_imageStreamDecoder.skippedElements();
+        m_imageStreamDecoder.finish();
+        endFrame();
+        if (m_imageStreamFinishedHandler) {
+            m_imageStreamFinishedHandler(fields, skippedElements);
+        }
+    } else {
+        // 이미지 응답이 아니면 모은 프레임을 일반 경로로 처리
+        const QByteArray payload = m_imageStreamDecoder.finish();
+        endFrame();
+        qDebug() << "[TCP] Complete message received:" << payload.size() << "bytes";
+        if (m_frameHandler) {
+            m_frameHandler(payload, false);
+        }
+    }
+}
+
+/**
+ * @brief 임시 파일 프레임 종료 처리
+ * @details 임시 파일 프레임은 스트리밍 이미지 응답만 받으므로 스트리밍 프레임과 같이 마무리한 뒤
+ *          임시 파일을 삭제합니다. 프레임 전체를 처리기에 넘기는 경로는 없습니다.
+ */
+void FrameCodec::finishSpilledFrame()
+{
+    m_spillingFrame = false;
+
+    if (!m_imageStreamDecoder.isStreaming()) {
+        // 메시지 ID 없이 끝난 프레임 (feedSpilledFrame()에서 걸러지지 않은 비정상 응답)
+        fail(QString("Frame too large to decode (%1 bytes).").arg(m_expectedFrameLength));
+        return;
+    }
+
+    m_deliveringSpilledFrame = true;
+    if (m_imageStreamDecoder.skippedElements() > 0) {
+        qDebug() << "[TCP] 크기 상한 초과로 건너뛴 이미지:" << m_imageStreamDecoder.skippedElements() << "장";
+    }
+    finishStreamingFrame();
+    m_deliveringSpilledFrame = false;
+    m_spillFile.release();
+}
+
+/**
+ * @brief 다음 프레임을 위한 헤더 상태 초기화
+ */
+void FrameCodec::endFrame()
+{
+    m_frameLengthReceived = false;
+    m_expectedFrameLength = 0;
+    m_frameCompressed = false;
+    m_frameBytesRemaining = 0;
+}
+
+/**
+ * @brief 오류 기록 및 처리기 호출
+ * @param error 오류 메시지
+ */
+void FrameCodec::fail(const QString &error)
+{
+    m_error = true;
+    m_spillFile.release();
+    if (m_errorHandler) {
+        m_errorHandler(error);
+    }
+}
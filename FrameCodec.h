@@ -0,0 +1,192 @@
+#ifndef FRAMECODEC_H
+#define FRAMECODEC_H
+
+#include <QByteArray>
+#include <QJsonObject>
+#include <QList>
+#include <QString>
+#include <functional>
+
+#include "ChunkedRingBuffer.h"
+#include "FrameSpillFile.h"
+#include "ImageStreamDecoder.h"
+
+/**
+ * @brief 압축 프레임 표시 비트
+ * @details 길이 헤더의 최상위 비트가 켜져 있으면 페이로드가 qCompress(zlib) 형식입니다.
+ *          나머지 31비트가 실제 전송 길이이며, "frame_compression" 협상 후에만 사용합니다.
+ */
+constexpr quint32 FrameCompressedFlag = 0x80000000u;
+
+/**
+ * @brief 길이 프리픽스 프레임 코덱
+ * @details 4바이트 빅엔디안 길이 헤더 + 페이로드 형식의 프레이밍을 소켓과 무관하게 처리합니다.
+ *          임의로 잘린 바이트 조각을 feed()로 넣으면 완성된 프레임을 처리기로 넘기며, 크기에 따라
+ *          세 경로로 받습니다.
+ *          - 일반 프레임: 수신 버퍼에 모았다가 한 번에 전달
+ *          - 스트리밍 기준 이상(비압축): 이미지 응답이면 data[] 원소를 도착하는 대로 전달
+ *          - 메모리 상한 초과: 임시 파일에 쓰고 매핑에서 이미지 원소만 스트리밍 디코딩
+ *            (원소 단위로 나눌 수 없는 프레임 - 압축, CBOR, 이미지 응답이 아닌 메시지 - 는 오류)
+ *          절대 상한을 넘는 길이 헤더는 오류로 보고 reset() 전까지 더 이상 디코딩하지 않습니다.
+ *          처리기 안에서 reset()을 불러도 안전합니다.
+ */
+class FrameCodec
+{
+public:
+    /** @brief 완성된 프레임 처리기 (payload: 전송된 그대로, compressed: 압축 표시 비트) */
+    using FrameHandler = std::function<void(const QByteArray &payload, bool compressed)>;
+    /** @brief 스트리밍 이미지 원소 처리기 (이미지 응답으로 확인된 뒤 조각을 받을 때마다, 빈 리스트일 수 있음) */
+    using ImageElementsHandler = std::function<void(const QList<QByteArray> &elements)>;
+    /** @brief 스트리밍 이미지 응답 종료 처리기 (data 외 최상위 필드, 크기 상한으로 건너뛴 원소 수) */
+    using ImageStreamFinishedHandler = std::function<void(const QJsonObject &fields, int skippedElements)>;
+    /** @brief 프레이밍 오류 처리기 (이후 스트림은 복구할 수 없으므로 연결을 재설정해야 함) */
+    using ErrorHandler = std::function<void(const QString &error)>;
+
+    /**
+     * @brief FrameCodec 생성자
+     */
+    FrameCodec();
+
+    /**
+     * @brief 완성된 프레임 처리기 설정
+     * @param handler 처리기
+     */
+    void setFrameHandler(FrameHandler handler) { m_frameHandler = std::move(handler); }
+    /**
+     * @brief 스트리밍 이미지 원소 처리기 설정
+     * @param handler 처리기
+     */
+    void setImageElementsHandler(ImageElementsHandler handler) { m_imageElementsHandler = std::move(handler); }
+    /**
+     * @brief 스트리밍 이미지 응답 종료 처리기 설정
+     * @param handler 처리기
+     */
+    void setImageStreamFinishedHandler(ImageStreamFinishedHandler handler) { m_imageStreamFinishedHandler = std::move(handler); }
+    /**
+     * @brief 프레이밍 오류 처리기 설정
+     * @param handler 처리기
+     */
+    void setErrorHandler(ErrorHandler handler) { m_errorHandler = std::move(handler); }
+
+    /**
+     * @brief 프레임 크기 상한 설정
+     * @param maxInMemoryBytes 메모리 상한(바이트) - 넘으면 임시 파일 사용, 스트리밍 원소 상한으로도 사용
+     * @param maxFrameBytes 절대 상한(바이트) - 넘으면 오류
+     */
+    void setLimits(qint64 maxInMemoryBytes, qint64 maxFrameBytes);
+    /**
+     * @brief 스트리밍 디코딩 적용 프레임 크기 기준 설정
+     * @param thresholdBytes 기준 크기(바이트)
+     */
+    void setStreamingThreshold(qint64 thresholdBytes) { m_streamingThresholdBytes = thresholdBytes; }
+    /**
+     * @brief 메모리 상한 반환
+     * @return 바이트 수
+     */
+    qint64 maxInMemoryBytes() const { return m_maxInMemoryBytes; }
+    /**
+     * @brief 절대 상한 반환
+     * @return 바이트 수
+     */
+    qint64 maxFrameBytes() const { return m_maxFrameBytes; }
+
+    /**
+     * @brief 수신 조각 입력
+     * @details 조각 경계는 프레임 경계와 무관해도 됩니다. 완성된 프레임마다 처리기를 호출합니다.
+     * @param chunk 수신 조각 (암시적 공유로 보관, 복사 없음)
+     * @return 이번 호출에서 완료한 프레임 수
+     */
+    int feed(const QByteArray &chunk);
+    /**
+     * @brief 디코딩 상태 초기화 (새 연결)
+     */
+    void reset();
+
+    /**
+     * @brief 프레이밍 오류 발생 여부
+     * @return 오류 후 reset() 전이면 true
+     */
+    bool hasError() const { return m_error; }
+    /**
+     * @brief 아직 프레임으로 소비하지 않은 수신 바이트 수
+     * @return 바이트 수
+     */
+    qint64 bufferedBytes() const { return m_buffer.size(); }
+    /**
+     * @brief 스트리밍 중인 이미지 응답에서 지금까지 받은 최상위 필드
+     * @details data 앞에 온 필드(seq 등)만 들어 있으며, 전체 필드는 종료 처리기로 전달됩니다.
+     * @return data 외 최상위 필드
+     */
+    QJsonObject imageStreamFields() const { return m_imageStreamDecoder.topLevelFields(); }
+
+    /**
+     * @brief 프레임 인코딩
+     * @details 길이 헤더와 페이로드를 하나의 버퍼로 만듭니다.
+     * @param payload 페이로드 (compressed면 qCompress 결과)
+     * @param compressed 압축 표시 비트 설정 여부
+     * @return 전송할 프레임
+     */
+    static QByteArray encode(const QByteArray &payload, bool compressed = false);
+
+private:
+    /** @brief 길이 헤더를 읽고 수신 경로 결정 (false면 오류) */
+    bool beginFrame();
+    /** @brief 임시 파일 프레임 수신 (false면 오류) */
+    bool feedSpilledFrame();
+    /** @brief 스트리밍 프레임 수신 */
+    void feedStreamingFrame();
+    /** @brief 스트리밍 디코더에서 완성된 이미지 원소 전달 */
+    void emitImageElements();
+    /** @brief 스트리밍 프레임 종료 처리 */
+    void finishStreamingFrame();
+    /** @brief 임시 파일 프레임 종료 처리 */
+    void finishSpilledFrame();
+    /** @brief 다음 프레임을 위한 헤더 상태 초기화 */
+    void endFrame();
+    /** @brief 오류 기록 및 처리기 호출 */
+    void fail(const QString &error);
+
+    /** @brief 수신 버퍼 */
+    ChunkedRingBuffer m_buffer;
+    /** @brief 이미지 스트리밍 디코더 */
+    ImageStreamDecoder m_imageStreamDecoder;
+    /** @brief 대용량 프레임 임시 파일 */
+    FrameSpillFile m_spillFile;
+
+    /** @brief 수신 중인 프레임 길이 */
+    quint32 m_expectedFrameLength;
+    /** @brief 프레임 길이 헤더 수신 여부 */
+    bool m_frameLengthReceived;
+    /** @brief 수신 중인 프레임의 압축 여부 (길이 헤더 최상위 비트) */
+    bool m_frameCompressed;
+    /** @brief 스트리밍 중인 프레임 여부 */
+    bool m_streamingFrame;
+    /** @brief 임시 파일로 받는 중인 프레임 여부 */
+    bool m_spillingFrame;
+    /** @brief 스트리밍/임시 파일 프레임 남은 바이트 */
+    quint32 m_frameBytesRemaining;
+    /** @brief 프레이밍 오류 여부 */
+    bool m_error;
+    /** @brief reset() 호출 횟수 (처리기 안에서 초기화되었는지 확인용) */
+    quint64 m_generation;
+    /** @brief 임시 파일 매핑 뷰를 처리기에 넘기는 중인지 여부 (그동안 reset()이 파일을 지우지 않음) */
+    bool m_deliveringSpilledFrame;
+
+    /** @brief 스트리밍 디코딩 적용 프레임 크기 기준 */
+    qint64 m_streamingThresholdBytes;
+    /** @brief 메모리 상한 */
+    qint64 m_maxInMemoryBytes;
+    /** @brief 절대 상한 */
+    qint64 m_maxFrameBytes;
+
+    /** @brief 완성된 프레임 처리기 */
+    FrameHandler m_frameHandler;
+    /** @brief 스트리밍 이미지 원소 처리기 */
+    ImageElementsHandler m_imageElementsHandler;
+    /** @brief 스트리밍 이미지 응답 종료 처리기 */
+    ImageStreamFinishedHandler m_imageStreamFinishedHandler;
+    /** @brief 프레이밍 오류 처리기 */
+    ErrorHandler m_errorHandler;
+};
+
+#endif // FRAMECODEC_H
@@ -0,0 +1,114 @@
+#include "FrameSpillFile.h"
+
+#include <QDebug>
+#include <QDir>
+
+/**
+ * @brief FrameSpillFile 생성자
+ */
+FrameSpillFile::FrameSpillFile()
+    : m_file(nullptr)
+    , m_map(nullptr)
+    , m_size(0)
+    , m_written(0)
+{
+}
+
+/**
+ * @brief FrameSpillFile 소멸자
+ */
+FrameSpillFile::~FrameSpillFile()
+{
+    release();
+}
+
+/**
+ * @brief 새 프레임 기록 시작
+ * @param size 프레임 크기(바이트)
+ * @return 성공 여부
+ */
+bool FrameSpillFile::begin(qint64 size)
+{
+    release();
+    if (size <= 0) {
+        return false;
+    }
+
+    m_file = new QTemporaryFile(QDir::tempPath() + "/cctv_frame_XXXXXX.spill");
+    if (!m_file->open()) {
+        qDebug() << "[TCP] 프레임 임시 파일 생성 실패:" << m_file->errorString();
+        release();
+        return false;
+    }
+
+    // 미리 늘려 두면 대부분의 파일 시스템에서 희소 파일로 잡혀 실제 디스크는 쓴 만큼만 사용
+    if (!m_file->resize(size)) {
+        qDebug() << "[TCP] 프레임 임시 파일 크기 설정 실패:" << size << "바이트 -" << m_file->errorString();
+        release();
+        return false;
+    }
+
+    m_map = m_file->map(0, size);
+    if (!m_map) {
+        qDebug() << "[TCP] 프레임 임시 파일 매핑 실패:" << m_file->errorString();
+        release();
+        return false;
+    }
+
+    m_size = size;
+    m_written = 0;
+    return true;
+}
+
+/**
+ * @brief 수신 조각 이어 쓰기
+ * @details 매핑에 직접 쓰지 않고 파일에 쓰므로 더러운 페이지가 프로세스 메모리에 쌓이지 않습니다.
+ * @param data 수신 조각
+ * @return 성공 여부 (프레임 크기를 넘거나 쓰기 실패 시 false)
+ */
+bool FrameSpillFile::append(const QByteArray &data)
+{
+    if (!m_file || m_written + data.size() > m_size) {
+        return false;
+    }
+
+    if (m_file->write(data) != data.size()) {
+        qDebug() << "[TCP] 프레임 임시 파일 쓰기 실패:" << m_file->errorString();
+        return false;
+    }
+    // 매핑으로 바로 읽을 수 있도록 Qt 쓰기 버퍼를 비움
+    m_file->flush();
+    m_written += data.size();
+    return true;
+}
+
+/**
+ * @brief 매핑된 구간 뷰 반환 (복사 없음)
+ * @param offset 시작 위치
+ * @param length 길이
+ * @return 구간 뷰 (범위를 벗어나면 빈 배열)
+ */
+QByteArray FrameSpillFile::view(qint64 offset, qint64 length) const
+{
+    if (!m_map || offset < 0 || length <= 0 || offset + length > m_written) {
+        return QByteArray();
+    }
+    return QByteArray::fromRawData(reinterpret_cast<const char *>(m_map + offset), length);
+}
+
+/**
+ * @brief 임시 파일 해제 및 삭제
+ */
+void FrameSpillFile::release()
+{
+    if (m_file) {
+        if (m_map) {
+            m_file->unmap(m_map);
+        }
+        delete m_file;  // QTemporaryFile 소멸 시 파일 삭제
+    }
+    m_file = nullptr;
+    m_map = nullptr;
+    m_size = 0;
+    m_written = 0;
+}
@@ -0,0 +1,87 @@
+#ifndef FRAMESPILLFILE_H
+#define FRAMESPILLFILE_H
+
+#include <QByteArray>
+#include <QTemporaryFile>
+
+/**
+ * @brief 대용량 수신 프레임용 임시 파일
+ * @details 메모리 상한을 넘는 프레임을 받을 때 도착한 조각을 바로 임시 파일에 쓰고, 파일 전체를
+ *          메모리 매핑해 둡니다. 디코더는 매핑에서 복사 없이 QByteArray 뷰로 읽으므로,
+ *          프레임 내용은 힙이 아닌 페이지 캐시에 머물고 커널이 필요에 따라 회수할 수 있습니다.
+ *          임시 파일은 release() 또는 소멸 시 삭제됩니다.
+ */
+class FrameSpillFile
+{
+public:
+    /**
+     * @brief FrameSpillFile 생성자
+     */
+    FrameSpillFile();
+    /**
+     * @brief FrameSpillFile 소멸자
+     */
+    ~FrameSpillFile();
+
+    FrameSpillFile(const FrameSpillFile &) = delete;
+    FrameSpillFile &operator=(const FrameSpillFile &) = delete;
+
+    /**
+     * @brief 새 프레임 기록 시작
+     * @details 프레임 크기만큼 임시 파일을 늘리고 매핑합니다.
+     * @param size 프레임 크기(바이트)
+     * @return 성공 여부
+     */
+    bool begin(qint64 size);
+    /**
+     * @brief 수신 조각 이어 쓰기
+     * @param data 수신 조각
+     * @return 성공 여부 (프레임 크기를 넘거나 쓰기 실패 시 false)
+     */
+    bool append(const QByteArray &data);
+    /**
+     * @brief 매핑된 구간 뷰 반환 (복사 없음)
+     * @details 반환된 배열은 release() 전까지만 유효합니다.
+     * @param offset 시작 위치
+     * @param length 길이
+     * @return 구간 뷰 (범위를 벗어나면 빈 배열)
+     */
+    QByteArray view(qint64 offset, qint64 length) const;
+    /**
+     * @brief 프레임 전체 뷰 반환 (복사 없음)
+     * @return 프레임 뷰
+     */
+    QByteArray data() const { return view(0, m_written); }
+    /**
+     * @brief 임시 파일 해제 및 삭제
+     */
+    void release();
+
+    /**
+     * @brief 기록 중인 프레임 여부
+     * @return 기록 중이면 true
+     */
+    bool isActive() const { return m_map != nullptr; }
+    /**
+     * @brief 프레임 크기 반환
+     * @return 바이트 수
+     */
+    qint64 size() const { return m_size; }
+    /**
+     * @brief 지금까지 쓴 바이트 수 반환
+     * @return 바이트 수
+     */
+    qint64 written() const { return m_written; }
+
+private:
+    /** @brief 임시 파일 (release 시 삭제) */
+    QTemporaryFile *m_file;
+    /** @brief 파일 매핑 시작 주소 */
+    uchar *m_map;
+    /** @brief 프레임 크기 */
+    qint64 m_size;
+    /** @brief 쓴 바이트 수 */
+    qint64 m_written;
+};
+
+#endif // FRAMESPILLFILE_H
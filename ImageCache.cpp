@@ -0,0 +1,165 @@
+#include "ImageCache.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+
+/**
+ * @brief ImageCache 생성자
+ */
+ImageCache::ImageCache()
+    : m_maxBytes(0)
+    , m_totalBytes(0)
+{
+}
+
+/**
+ * @brief 캐시 디렉터리 열기
+ * @param dirPath 캐시 디렉터리 경로
+ * @param maxBytes 전체 크기 상한(바이트), 0 이하면 상한 없음
+ * @return 성공 여부
+ */
+bool ImageCache::open(const QString &dirPath, qint64 maxBytes)
+{
+    m_dirPath.clear();
+    m_entries.clear();
+    m_totalBytes = 0;
+    m_maxBytes = maxBytes;
+
+    QDir dir(dirPath);
+    if (!dir.mkpath(".")) {
+        qDebug() << "[ImageCache] 캐시 디렉터리 생성 실패:" << dirPath;
+        return false;
+    }
+
+    // 수정 시각이 오래된 순서 = 오래 쓰지 않은 순서
+    const QFileInfoList files = dir.entryInfoList(QStringList() << "*.jpg", QDir::Files, QDir::Time | QDir::Reversed);
+    m_entries.reserve(files.size());
+    for (const QFileInfo &info : files) {
+        m_entries.append(Entry{info.fileName(), info.size()});
+        m_totalBytes += info.size();
+    }
+
+    m_dirPath = dir.absolutePath();
+    evict();
+
+    qDebug() << "[ImageCache] 캐시 열기 -" << m_entries.size() << "개," << m_totalBytes / 1024 << "KB:" << m_dirPath;
+    return true;
+}
+
+/**
+ * @brief 캐시된 원본 경로 반환
+ * @param imageId 이미지 ID
+ * @return 파일 경로 (없으면 빈 문자열)
+ */
+QString ImageCache::lookup(const QString &imageId)
+{
+    if (!isOpen() || imageId.isEmpty()) {
+        return QString();
+    }
+
+    const QString fileName = fileNameFor(imageId);
+    const int index = indexOf(fileName);
+    if (index < 0) {
+        return QString();
+    }
+
+    const QString filePath = QDir(m_dirPath).absoluteFilePath(fileName);
+    QFile file(filePath);
+    if (!file.exists()) {
+        // 밖에서 지워진 파일
+        m_totalBytes -= m_entries.at(index).bytes;
+        m_entries.removeAt(index);
+        return QString();
+    }
+
+    // 최근 사용으로 표시 (다음 실행에서도 순서가 유지되도록 수정 시각 갱신)
+    m_entries.move(index, m_entries.size() - 1);
+    if (file.open(QIODevice::ReadWrite)) {
+        file.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+        file.close();
+    }
+    return filePath;
+}
+
+/**
+ * @brief 원본 저장
+ * @param imageId 이미지 ID
+ * @param imageBytes 이미지 바이트 (JPEG)
+ * @return 저장된 파일 경로 (실패 시 빈 문자열)
+ */
+QString ImageCache::store(const QString &imageId, const QByteArray &imageBytes)
+{
+    if (!isOpen() || imageId.isEmpty() || imageBytes.isEmpty()) {
+        return QString();
+    }
+
+    const QString fileName = fileNameFor(imageId);
+    const QString filePath = QDir(m_dirPath).absoluteFilePath(fileName);
+
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly) || file.write(imageBytes) != imageBytes.size() || !file.commit()) {
+        qDebug() << "[ImageCache] 원본 저장 실패:" << filePath << file.errorString();
+        return QString();
+    }
+
+    const int index = indexOf(fileName);
+    if (index >= 0) {
+        m_totalBytes -= m_entries.at(index).bytes;
+        m_entries.removeAt(index);
+    }
+    m_entries.append(Entry{fileName, imageBytes.size()});
+    m_totalBytes += imageBytes.size();
+
+    evict();
+    return filePath;
+}
+
+/**
+ * @brief 이미지 ID → 캐시 파일 이름
+ * @details 서버가 정한 ID에 경로 문자가 섞여 있어도 안전하도록 해시를 파일 이름으로 씁니다.
+ * @param imageId 이미지 ID
+ * @return 파일 이름
+ */
+QString ImageCache::fileNameFor(const QString &imageId)
+{
+    const QByteArray hash = QCryptographicHash::hash(imageId.toUtf8(), QCryptographicHash::Sha1);
+    return QString::fromLatin1(hash.toHex()) + ".jpg";
+}
+
+/**
+ * @brief 파일 이름으로 항목 인덱스 찾기
+ * @param fileName 파일 이름
+ * @return 인덱스 (없으면 -1)
+ */
+int ImageCache::indexOf(const QString &fileName) const
+{
+    for (int i = m_entries.size() - 1; i >= 0; --i) {
+        if (m_entries.at(i).fileName == fileName) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief 상한을 넘는 만큼 오래된 항목 삭제
+ * @details 방금 넣은 마지막 항목은 상한보다 커도 남겨 둡니다.
+ */
+void ImageCache::evict()
+{
+    if (m_maxBytes <= 0) {
+        return;
+    }
+
+    QDir dir(m_dirPath);
+    while (m_totalBytes > m_maxBytes && m_entries.size() > 1) {
+        const Entry oldest = m_entries.takeFirst();
+        dir.remove(oldest.fileName);
+        m_totalBytes -= oldest.bytes;
+    }
+}
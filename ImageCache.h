@@ -0,0 +1,89 @@
+#ifndef IMAGECACHE_H
+#define IMAGECACHE_H
+
+#include <QByteArray>
+#include <QList>
+#include <QString>
+
+/**
+ * @brief 원본 이미지 디스크 캐시
+ * @details 캡처 목록은 썸네일만 받고 원본은 뷰어에서 열 때 image_id로 따로 받으므로, 한 번 받은 원본을
+ *          image_id별 파일로 보관해 다시 열 때 서버에 묻지 않도록 합니다. 전체 크기가 상한을 넘으면
+ *          가장 오래 쓰지 않은 파일부터 지우며, 사용 순서는 파일 수정 시각으로 남겨 재실행 후에도 유지됩니다.
+ *          GUI 스레드에서만 사용합니다.
+ */
+class ImageCache
+{
+public:
+    /**
+     * @brief ImageCache 생성자
+     */
+    ImageCache();
+
+    /**
+     * @brief 캐시 디렉터리 열기
+     * @details 디렉터리가 없으면 만들고, 기존 파일을 사용 순서대로 읽어 상한에 맞게 정리합니다.
+     * @param dirPath 캐시 디렉터리 경로
+     * @param maxBytes 전체 크기 상한(바이트), 0 이하면 상한 없음
+     * @return 성공 여부
+     */
+    bool open(const QString &dirPath, qint64 maxBytes);
+    /**
+     * @brief 열려 있는지 여부
+     * @return 열려 있으면 true
+     */
+    bool isOpen() const { return !m_dirPath.isEmpty(); }
+
+    /**
+     * @brief 캐시된 원본 경로 반환
+     * @details 찾으면 가장 최근에 쓴 항목으로 표시합니다.
+     * @param imageId 이미지 ID
+     * @return 파일 경로 (없으면 빈 문자열)
+     */
+    QString lookup(const QString &imageId);
+    /**
+     * @brief 원본 저장
+     * @param imageId 이미지 ID
+     * @param imageBytes 이미지 바이트 (JPEG)
+     * @return 저장된 파일 경로 (실패 시 빈 문자열)
+     */
+    QString store(const QString &imageId, const QByteArray &imageBytes);
+
+    /**
+     * @brief 캐시 전체 크기 반환
+     * @return 바이트 수
+     */
+    qint64 totalBytes() const { return m_totalBytes; }
+    /**
+     * @brief 캐시 항목 수 반환
+     * @return 항목 수
+     */
+    int size() const { return m_entries.size(); }
+
+private:
+    /**
+     * @brief 캐시 항목
+     */
+    struct Entry {
+        QString fileName;   // 캐시 파일 이름
+        qint64 bytes;       // 파일 크기
+    };
+
+    /** @brief 이미지 ID → 캐시 파일 이름 */
+    static QString fileNameFor(const QString &imageId);
+    /** @brief 파일 이름으로 항목 인덱스 찾기 */
+    int indexOf(const QString &fileName) const;
+    /** @brief 상한을 넘는 만큼 오래된 항목 삭제 */
+    void evict();
+
+    /** @brief 캐시 디렉터리 경로 */
+    QString m_dirPath;
+    /** @brief 전체 크기 상한 (0 이하면 상한 없음) */
+    qint64 m_maxBytes;
+    /** @brief 전체 크기 */
+    qint64 m_totalBytes;
+    /** @brief 항목 (오래 쓰지 않은 순서) */
+    QList<Entry> m_entries;
+};
+
+#endif // IMAGECACHE_H
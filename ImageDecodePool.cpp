@@ -0,0 +1,213 @@
+#include "ImageDecodePool.h"
+#include "Base64Decoder.h"
+
+#include <QAtomicInteger>
+#include <QDebug>
+#include <QDir>
+#include <QRegularExpression>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QThread>
+
+/**
+ * @brief ImageDecodePool 생성자
+ * @param parent 부모 객체
+ */
+ImageDecodePool::ImageDecodePool(QObject *parent)
+    : QObject(parent)
+    , m_inFlight(0)
+    , m_maxInFlight(0)
+    , m_generation(0)
+    , m_nextSequence(0)
+    , m_nextToEmit(0)
+{
+    setMaxThreads(0);
+}
+
+/**
+ * @brief ImageDecodePool 소멸자
+ * @details 실행 중인 작업이 끝날 때까지 기다립니다.
+ */
+ImageDecodePool::~ImageDecodePool()
+{
+    m_pool.waitForDone();
+}
+
+/**
+ * @brief 작업 스레드 수 설정
+ * @param threads 스레드 수 (0 이하면 CPU 코어 수)
+ */
+void ImageDecodePool::setMaxThreads(int threads)
+{
+    if (threads <= 0) {
+        threads = qMax(1, QThread::idealThreadCount());
+    }
+    m_pool.setMaxThreadCount(threads);
+
+    // 작업 스레드가 쉬지 않도록 스레드 수의 두 배까지 미리 넣어 둠
+    const bool wasSaturated = isSaturated();
+    m_maxInFlight = threads * 2;
+    if (wasSaturated && !isSaturated()) {
+        emit capacityAvailable();
+    }
+
+    qDebug() << "[TCP] 이미지 디코딩 스레드:" << threads << "개, 동시 처리 상한:" << m_maxInFlight << "장, base64 경로:"
+             << Base64Decoder::backendName();
+}
+
+/**
+ * @brief 배치 시작
+ * @param fields 배치 시작 시점의 data 외 최상위 필드 (batchStarted로 전달)
+ */
+void ImageDecodePool::beginBatch(const QJsonObject &fields)
+{
+    complete(m_generation, m_nextSequence++, Event{Event::Type::BatchStart, ImageData(), fields});
+}
+
+/**
+ * @brief 이미지 하나 디코딩/저장 요청
+ * @param image 이미지 메타데이터 (imagePath는 저장 후 채워짐)
+ * @param payload 이미지 본문 (또는 본문을 담은 원소 버퍼, 복사 없이 공유)
+ * @param base64 본문이 base64 문자열이면 true, 디코딩된 바이트면 false
+ * @param offset payload 안에서 본문 시작 위치
+ * @param length 본문 길이 (-1이면 offset부터 끝까지)
+ */
+void ImageDecodePool::submit(const ImageData &image, const QByteArray &payload, bool base64,
+                             qsizetype offset, qsizetype length)
+{
+    // 소유 스레드의 이벤트 루프를 막지 않도록 기다리지 않음 (상한은 호출 측이 수신을 멈춰 지킴)
+    m_inFlight++;
+
+    const quint64 generation = m_generation;
+    const quint64 sequence = m_nextSequence++;
+    if (length < 0) {
+        length = payload.size() - offset;
+    }
+    m_pool.start([this, image, payload, base64, offset, length, generation, sequence]() {
+        Event event{Event::Type::Image, image, QJsonObject()};
+        event.image.imagePath = saveImage(QByteArrayView(payload).sliced(offset, length), base64,
+                                          image.timestamp, image.imageId);
+
+        QMetaObject::invokeMethod(this, [this, generation, sequence, event]() {
+            const bool wasSaturated = isSaturated();
+            m_inFlight--;
+            complete(generation, sequence, event);
+            if (wasSaturated && !isSaturated()) {
+                emit capacityAvailable();
+            }
+        }, Qt::QueuedConnection);
+    });
+}
+
+/**
+ * @brief 배치 종료
+ * @param fields 응답의 data 외 최상위 필드
+ */
+void ImageDecodePool::finishBatch(const QJsonObject &fields)
+{
+    complete(m_generation, m_nextSequence++, Event{Event::Type::BatchEnd, ImageData(), fields});
+}
+
+/**
+ * @brief 진행 중인 모든 배치 폐기 (연결 해제)
+ */
+void ImageDecodePool::cancel()
+{
+    m_generation++;
+    m_completed.clear();
+    m_nextToEmit = m_nextSequence;
+}
+
+/**
+ * @brief 이미지 본문 디코딩 및 임시 폴더에 저장
+ * @param payload 이미지 본문
+ * @param base64 본문이 base64 문자열이면 true (data URL 접두사 허용)
+ * @param timestamp 타임스탬프 (파일 이름)
+ * @param imageId 이미지 ID (파일 이름, 없으면 빈 문자열)
+ * @return 저장된 파일 경로 (실패 시 빈 문자열)
+ */
+QString ImageDecodePool::saveImage(QByteArrayView payload, bool base64, const QString &timestamp, const QString &imageId)
+{
+    QByteArray imageBytes;
+    if (base64) {
+        // "data:image/jpeg;base64," 접두사는 뷰만 옮겨 제거
+        const QByteArrayView encoded = Base64Decoder::stripDataUrlPrefix(payload);
+        // 이스케이프("\/")나 줄바꿈이 섞인 본문은 정리한 뒤 다시 디코딩
+        if (!Base64Decoder::decodeLenient(encoded, imageBytes)) {
+            qDebug() << "[TCP] Failed to decode image:" << timestamp;
+            return QString();
+        }
+    } else {
+        imageBytes = payload.toByteArray();
+    }
+
+    QString tempDir = QStandardPaths::writableLocation(QStandardPaths::TempLocation);
+    QString cleanTimestamp = timestamp;
+    cleanTimestamp.replace(":", "_").replace("-", "_");
+
+    // 같은 초에 찍힌 이미지끼리 덮어쓰지 않도록 ID(없으면 일련번호)를 붙임
+    // 작업 스레드마다 이미지당 정규식을 다시 컴파일하지 않도록 한 번만 생성 (const 사용은 스레드 안전)
+    static const QRegularExpression unsafeChars(QStringLiteral("[^A-Za-z0-9_.-]"));
+    static QAtomicInteger<quint32> fileCounter;
+    QString uniquePart = imageId;
+    uniquePart.replace(unsafeChars, QStringLiteral("_"));
+    if (uniquePart.isEmpty()) {
+        uniquePart = QString("n%1").arg(fileCounter.fetchAndAddRelaxed(1));
+    }
+    QString fileName = QString("CCTVImage%1_%2.jpg").arg(cleanTimestamp, uniquePart);
+    QString filePath = QDir(tempDir).absoluteFilePath(fileName);
+
+    // 임시 파일에 쓴 뒤 이름을 바꿔, 같은 이미지를 동시에 저장하거나 읽어도 쓰다 만 파일이 보이지 않음
+    QSaveFile file(filePath);
+    if (file.open(QIODevice::WriteOnly) && file.write(imageBytes) == imageBytes.size() && file.commit()) {
+        qDebug() << "[TCP] Image saved successfully:" << filePath;
+        return filePath;
+    } else {
+        qDebug() << "[TCP] Failed to save image:" << filePath;
+        return QString();
+    }
+}
+
+/**
+ * @brief 완료된 항목을 순서 큐에 넣고 이어지는 항목 내보내기
+ * @param generation 항목을 만든 시점의 cancel() 횟수
+ * @param sequence 순서 번호
+ * @param event 완료된 항목
+ */
+void ImageDecodePool::complete(quint64 generation, quint64 sequence, const Event &event)
+{
+    if (generation != m_generation) {
+        return;     // 끊긴 연결의 늦은 결과
+    }
+    m_completed.insert(sequence, event);
+    drain();
+}
+
+/**
+ * @brief 다음 순서부터 완료된 항목 내보내기
+ * @details 시그널 수신 측에서 cancel()을 부르면 남은 항목은 내보내지 않습니다.
+ */
+void ImageDecodePool::drain()
+{
+    const quint64 generation = m_generation;
+    while (generation == m_generation && !m_completed.isEmpty()
+           && m_completed.firstKey() == m_nextToEmit) {
+        const Event event = m_completed.take(m_nextToEmit);
+        m_nextToEmit++;
+
+        switch (event.type) {
+        case Event::Type::BatchStart:
+            emit batchStarted(event.fields);
+            break;
+        case Event::Type::Image:
+            // 저장에 실패한 이미지는 순서만 넘기고 내보내지 않음
+            if (!event.image.imagePath.isEmpty()) {
+                emit imageReady(event.image);
+            }
+            break;
+        case Event::Type::BatchEnd:
+            emit batchFinished(event.fields);
+            break;
+        }
+    }
+}
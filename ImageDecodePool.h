@@ -0,0 +1,142 @@
+#ifndef IMAGEDECODEPOOL_H
+#define IMAGEDECODEPOOL_H
+
+#include <QObject>
+#include <QByteArray>
+#include <QByteArrayView>
+#include <QJsonObject>
+#include <QMap>
+#include <QThreadPool>
+
+#include "TcpCommunicator.h"
+
+/**
+ * @brief 이미지 디코딩/저장 스레드 풀
+ * @details 이미지 응답의 원소마다 하던 base64 디코딩과 파일 저장을 작업 스레드로 나눠 실행하고,
+ *          결과는 제출한 순서대로 소유 스레드에서 시그널로 내보냅니다. 서버는 이미지 응답의 data[]를
+ *          타임스탬프 순(커서 페이징의 정렬 순서)으로 보내므로 제출 순서가 곧 타임스탬프 순서이며,
+ *          여기서 다시 정렬하지 않습니다 (TcpCommunicator::onImageDecoded가 어긋나면 기록).
+ *          배치 시작/종료도 같은 순서 큐에 들어가므로, 앞 배치의 이미지가 모두 나가기 전에
+ *          다음 배치가 시작되지 않습니다. submit()은 막지 않으며, 처리 중인 작업 수가 상한에 닿으면
+ *          isSaturated()가 true가 되어 호출 측이 소켓 읽기를 멈추고, 다시 여유가 생기면
+ *          capacityAvailable을 내보냅니다.
+ *          submit()/beginBatch()/finishBatch()/cancel()은 소유 스레드(네트워크 스레드)에서만 호출합니다.
+ */
+class ImageDecodePool : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief ImageDecodePool 생성자
+     * @param parent 부모 객체
+     */
+    explicit ImageDecodePool(QObject *parent = nullptr);
+    /**
+     * @brief ImageDecodePool 소멸자
+     * @details 실행 중인 작업이 끝날 때까지 기다립니다.
+     */
+    ~ImageDecodePool();
+
+    /**
+     * @brief 작업 스레드 수 설정
+     * @param threads 스레드 수 (0 이하면 CPU 코어 수)
+     */
+    void setMaxThreads(int threads);
+    /**
+     * @brief 작업 스레드 수 반환
+     * @return 스레드 수
+     */
+    int maxThreads() const { return m_pool.maxThreadCount(); }
+    /**
+     * @brief 처리 중인 작업 수가 상한에 닿았는지 여부
+     * @details true인 동안 호출 측은 새 이미지를 받지 않도록 수신을 멈춥니다.
+     * @return 상한 이상이면 true
+     */
+    bool isSaturated() const { return m_inFlight >= m_maxInFlight; }
+
+    /**
+     * @brief 배치 시작
+     * @details 앞선 결과가 모두 나간 뒤 batchStarted를 내보냅니다.
+     * @param fields 배치 시작 시점의 data 외 최상위 필드 (seq 등)
+     */
+    void beginBatch(const QJsonObject &fields);
+    /**
+     * @brief 이미지 하나 디코딩/저장 요청
+     * @details 상한과 관계없이 바로 작업을 넣고 반환합니다 (상한 확인은 호출 측이 isSaturated()로).
+     * @param image 이미지 메타데이터 (imagePath는 저장 후 채워짐)
+     * @param payload 이미지 본문 (또는 본문을 담은 원소 버퍼, 복사 없이 공유)
+     * @param base64 본문이 base64 문자열이면 true, 디코딩된 바이트면 false
+     * @param offset payload 안에서 본문 시작 위치
+     * @param length 본문 길이 (-1이면 offset부터 끝까지)
+     */
+    void submit(const ImageData &image, const QByteArray &payload, bool base64,
+                qsizetype offset = 0, qsizetype length = -1);
+    /**
+     * @brief 배치 종료
+     * @details 배치의 이미지가 모두 나간 뒤 batchFinished를 내보냅니다.
+     * @param fields 응답의 data 외 최상위 필드
+     */
+    void finishBatch(const QJsonObject &fields);
+    /**
+     * @brief 진행 중인 모든 배치 폐기 (연결 해제)
+     * @details 실행 중인 작업은 끝까지 돌지만 결과는 버립니다.
+     */
+    void cancel();
+
+    /**
+     * @brief 이미지 본문 디코딩 및 임시 폴더에 저장
+     * @details 작업 스레드에서 동시에 호출되므로 멤버 상태를 쓰지 않습니다. 파일 이름에 이미지 ID를 넣어
+     *          타임스탬프가 같은 이미지끼리 겹치지 않게 하고(ID가 없으면 프로세스 안 일련번호),
+     *          같은 이미지를 동시에 저장해도 원자적으로 교체되어 읽는 쪽이 쓰다 만 파일을 보지 않습니다.
+     * @param payload 이미지 본문
+     * @param base64 본문이 base64 문자열이면 true (data URL 접두사 허용)
+     * @param timestamp 타임스탬프 (파일 이름)
+     * @param imageId 이미지 ID (파일 이름, 없으면 빈 문자열)
+     * @return 저장된 파일 경로 (실패 시 빈 문자열)
+     */
+    static QString saveImage(QByteArrayView payload, bool base64, const QString &timestamp, const QString &imageId);
+
+signals:
+    /** @brief 배치 시작 (순서대로) */
+    void batchStarted(const QJsonObject &fields);
+    /** @brief 이미지 한 장 저장 완료 (제출 순서대로, 저장 실패한 이미지는 건너뜀) */
+    void imageReady(const ImageData &image);
+    /** @brief 배치 종료 (배치의 모든 이미지가 나간 뒤) */
+    void batchFinished(const QJsonObject &fields);
+    /** @brief 처리 중인 작업 수가 상한 아래로 내려감 (isSaturated()가 true였다가 false가 됨) */
+    void capacityAvailable();
+
+private:
+    /**
+     * @brief 순서 큐 항목
+     */
+    struct Event {
+        enum class Type { BatchStart, Image, BatchEnd };
+        Type type;
+        ImageData image;        // Image: 저장 결과
+        QJsonObject fields;     // BatchStart/BatchEnd: 최상위 필드
+    };
+
+    /** @brief 완료된 항목을 순서 큐에 넣고 이어지는 항목 내보내기 */
+    void complete(quint64 generation, quint64 sequence, const Event &event);
+    /** @brief 다음 순서부터 완료된 항목 내보내기 */
+    void drain();
+
+    /** @brief 작업 스레드 풀 */
+    QThreadPool m_pool;
+    /** @brief 처리 중 작업 수 (소유 스레드에서만 변경) */
+    int m_inFlight;
+    /** @brief 처리 중 작업 수 상한 (스레드 수의 배수) */
+    int m_maxInFlight;
+    /** @brief cancel() 횟수 (이전 연결의 늦은 결과 구분) */
+    quint64 m_generation;
+    /** @brief 다음에 부여할 순서 번호 */
+    quint64 m_nextSequence;
+    /** @brief 다음에 내보낼 순서 번호 */
+    quint64 m_nextToEmit;
+    /** @brief 완료됐지만 앞 순서를 기다리는 항목 */
+    QMap<quint64, Event> m_completed;
+};
+
+#endif // IMAGEDECODEPOOL_H
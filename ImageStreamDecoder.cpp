@@ -0,0 +1,473 @@
+#include "ImageStreamDecoder.h"
+
+#include <QJsonDocument>
+#include <QVariant>
+#include <cctype>
+#include <cstring>
+
+/**
+ * @brief ImageStreamDecoder 생성자
+ * @param streamResponseId 스트리밍할 응답 ID
+ */
+ImageStreamDecoder::ImageStreamDecoder(int streamResponseId)
+    : m_streamResponseId(streamResponseId)
+    , m_maxElementBytes(0)
+{
+    reset();
+}
+
+/**
+ * @brief 새 프레임 디코딩 시작
+ */
+void ImageStreamDecoder::begin()
+{
+    reset();
+    m_mode = Mode::Sniffing;
+}
+
+/**
+ * @brief 페이로드 조각 입력
+ * @param data 수신된 페이로드 조각
+ */
+void ImageStreamDecoder::feed(const QByteArray &data)
+{
+    if (m_mode == Mode::Idle) {
+        begin();
+    }
+
+    m_buffer.append(data);
+
+    // 다른 메시지로 판명되면 스캔 없이 모으기만 함
+    if (m_mode == Mode::Passthrough) {
+        return;
+    }
+
+    scan();
+    trim();
+}
+
+/**
+ * @brief 완료된 data[] 원소 가져오기
+ * @return 원소별 JSON 바이트 리스트
+ */
+QList<QByteArray> ImageStreamDecoder::takeElements()
+{
+    QList<QByteArray> elements;
+    elements.swap(m_elements);
+    return elements;
+}
+
+/**
+ * @brief 프레임 디코딩 종료
+ * @return 스트리밍이 아니었던 경우 전체 프레임, 스트리밍이었으면 빈 배열
+ */
+QByteArray ImageStreamDecoder::finish()
+{
+    QByteArray frame;
+    if (m_mode != Mode::Streaming) {
+        frame = m_buffer;
+    }
+    reset();
+    return frame;
+}
+
+/**
+ * @brief 상태 초기화
+ */
+void ImageStreamDecoder::reset()
+{
+    m_mode = Mode::Idle;
+    m_buffer.clear();
+    m_scanPos = 0;
+    m_depth = 0;
+    m_inString = false;
+    m_escape = false;
+    m_expectKey = false;
+    m_keyStart = -1;
+    m_currentKey.clear();
+    m_valueStart = -1;
+    m_inDataArray = false;
+    m_elementStart = -1;
+    m_pendingSpans.clear();
+    m_elements.clear();
+    m_topLevelFields = QJsonObject();
+    m_skippedElements = 0;
+}
+
+/**
+ * @brief 버퍼 스캔
+ * @details 문자열/이스케이프를 고려해 중첩 깊이를 추적하고 최상위 키와 data[] 원소 경계를 찾습니다.
+ */
+void ImageStreamDecoder::scan()
+{
+    const char *data = m_buffer.constData();
+    const qint64 size = m_buffer.size();
+    qint64 pos = m_scanPos;
+
+    while (pos < size && m_mode != Mode::Passthrough) {
+        if (m_inString) {
+            pos = scanString(pos);
+            continue;
+        }
+
+        const char c = data[pos];
+        switch (c) {
+        case '"':
+            m_inString = true;
+            if (m_depth == 1 && m_expectKey) {
+                m_keyStart = pos;
+            }
+            break;
+        case '{':
+        case '[':
+            if (m_depth == 0 && c != '{' && m_mode == Mode::Sniffing) {
+                // 최상위가 객체가 아니면 스트리밍 대상이 아님
+                m_mode = Mode::Passthrough;
+                break;
+            }
+            if (m_depth == 0) {
+                m_expectKey = true;
+            } else if (m_depth == 1 && c == '[' && m_currentKey == "data") {
+                // data 배열은 통째로 보관하지 않고 원소 단위로 처리
+                m_inDataArray = true;
+                m_valueStart = -1;
+            } else if (m_depth == 2 && m_inDataArray && c == '{') {
+                m_elementStart = pos;
+            }
+            ++m_depth;
+            break;
+        case '}':
+        case ']':
+            --m_depth;
+            if (m_depth == 2 && m_inDataArray && c == '}' && m_elementStart >= 0) {
+                onElement(m_elementStart, pos);
+                m_elementStart = -1;
+            } else if (m_depth == 1 && m_inDataArray && c == ']') {
+                m_inDataArray = false;
+            } else if (m_depth == 0 && m_valueStart >= 0) {
+                onTopLevelValue(m_valueStart, pos);
+                m_valueStart = -1;
+            }
+            break;
+        case ':':
+            if (m_depth == 1) {
+                m_expectKey = false;
+                m_valueStart = pos + 1;
+            }
+            break;
+        case ',':
+            if (m_depth == 1) {
+                if (m_valueStart >= 0) {
+                    onTopLevelValue(m_valueStart, pos);
+                    m_valueStart = -1;
+                }
+                m_expectKey = true;
+            }
+            break;
+        default:
+            // JSON이 아닌 페이로드(CBOR 등)는 그대로 모아서 반환
+            if (m_depth == 0 && m_mode == Mode::Sniffing && !std::isspace(static_cast<uchar>(c))) {
+                m_mode = Mode::Passthrough;
+            }
+            break;
+        }
+        ++pos;
+    }
+
+    m_scanPos = pos;
+}
+
+/**
+ * @brief 문자열 내부 스캔
+ * @details base64 같은 긴 문자열은 memchr로 닫는 따옴표까지 한 번에 건너뜁니다.
+ * @param pos 현재 위치
+ * @return 다음 스캔 위치
+ */
+qint64 ImageStreamDecoder::scanString(qint64 pos)
+{
+    const char *data = m_buffer.constData();
+    const qint64 size = m_buffer.size();
+
+    if (m_escape) {
+        m_escape = false;
+        return pos + 1;
+    }
+
+    const char *begin = data + pos;
+    const char *end = data + size;
+    const char *quote = static_cast<const char *>(std::memchr(begin, '"', static_cast<size_t>(end - begin)));
+    const char *limit = quote ? quote : end;
+    const char *backslash = static_cast<const char *>(std::memchr(begin, '\\', static_cast<size_t>(limit - begin)));
+
+    if (backslash) {
+        m_escape = true;
+        return (backslash - data) + 1;
+    }
+    if (!quote) {
+        return size;
+    }
+
+    // 문자열 종료
+    m_inString = false;
+    const qint64 quotePos = quote - data;
+    if (m_depth == 1 && m_expectKey && m_keyStart >= 0) {
+        m_currentKey = m_buffer.mid(m_keyStart + 1, quotePos - m_keyStart - 1);
+        m_keyStart = -1;
+    }
+    return quotePos + 1;
+}
+
+/**
+ * @brief 최상위 값 완료 처리
+ * @details 값을 최상위 필드에 기록하고, 메시지 ID가 확인되면 모드를 결정합니다.
+ * @param start 값 시작 위치
+ * @param end 값 끝 위치 (미포함)
+ */
+void ImageStreamDecoder::onTopLevelValue(qint64 start, qint64 end)
+{
+    const QByteArray raw = m_buffer.mid(start, end - start).trimmed();
+    if (raw.isEmpty()) {
+        return;
+    }
+
+    QByteArray wrapped;
+    wrapped.reserve(raw.size() + m_currentKey.size() + 8);
+    wrapped.append("{\"").append(m_currentKey).append("\":").append(raw).append('}');
+
+    const QJsonDocument doc = QJsonDocument::fromJson(wrapped);
+    if (!doc.isObject()) {
+        return;
+    }
+
+    const QJsonObject field = doc.object();
+    for (auto it = field.constBegin(); it != field.constEnd(); ++it) {
+        m_topLevelFields.insert(it.key(), it.value());
+    }
+
+    if (m_mode != Mode::Sniffing) {
+        return;
+    }
+
+    if (m_currentKey == "request_id" || m_currentKey == "response_id") {
+        int messageId = field.constBegin().value().toVariant().toInt();
+        if (messageId == 0) {
+            return;
+        }
+        if (messageId == m_streamResponseId) {
+            enterStreaming();
+        } else {
+            m_mode = Mode::Passthrough;
+            m_pendingSpans.clear();
+        }
+    }
+}
+
+/**
+ * @brief data[] 원소 완료 처리
+ * @param start 원소 시작 위치
+ * @param end 원소 끝 위치 (포함)
+ */
+void ImageStreamDecoder::onElement(qint64 start, qint64 end)
+{
+    if (m_mode == Mode::Streaming) {
+        m_elements.append(m_buffer.mid(start, end - start + 1));
+    } else {
+        // 메시지 ID 확인 전에는 위치만 기록
+        m_pendingSpans.append(qMakePair(start, end));
+    }
+}
+
+/**
+ * @brief 스트리밍 모드 전환
+ */
+void ImageStreamDecoder::enterStreaming()
+{
+    m_mode = Mode::Streaming;
+    for (const auto &span : std::as_const(m_pendingSpans)) {
+        m_elements.append(m_buffer.mid(span.first, span.second - span.first + 1));
+    }
+    m_pendingSpans.clear();
+}
+
+/**
+ * @brief 소비한 앞부분 버퍼 정리
+ * @details data 배열 내부에서는 진행 중인 원소 앞쪽을 모두 버리고, 진행 중인 원소가 최대 크기를
+ *          넘으면 그 원소도 버립니다 (닫는 괄호에서 시작 위치가 없으므로 방출되지 않음).
+ *          소비한 앞부분은 위치만 넘겨 두고, 남은 데이터보다 커졌을 때만 실제로 당깁니다.
+ *          옮기는 바이트가 버리는 바이트를 넘지 않으므로 조각마다 memmove하지 않고, 버퍼는
+ *          남은 데이터의 두 배를 넘지 않습니다.
+ */
+void ImageStreamDecoder::trim()
+{
+    if (m_mode != Mode::Streaming || !m_inDataArray) {
+        return;
+    }
+
+    if (m_maxElementBytes > 0 && m_elementStart >= 0 && m_scanPos - m_elementStart > m_maxElementBytes) {
+        m_elementStart = -1;
+        m_skippedElements++;
+    }
+
+    const qint64 keep = m_elementStart >= 0 ? m_elementStart : m_scanPos;
+    if (keep <= 0 || keep < m_buffer.size() - keep) {
+        return;
+    }
+
+    if (keep >= m_buffer.size()) {
+        m_buffer.clear();
+    } else {
+        m_buffer.remove(0, keep);
+    }
+    m_scanPos -= keep;
+    if (m_elementStart >= 0) {
+        m_elementStart -= keep;
+    }
+}
+
+/**
+ * @brief JSON 객체 텍스트에서 최상위 문자열 값의 위치 찾기
+ * @param object JSON 객체 텍스트
+ * @param key 찾을 키 (이스케이프 없는 키만 비교)
+ * @param start 값 시작 위치 (여는 따옴표 다음)
+ * @param end 값 끝 위치 (닫는 따옴표, 미포함)
+ * @return 키가 있고 값이 문자열이면 true
+ */
+bool ImageStreamDecoder::findStringValue(const QByteArray &object, const QByteArray &key, qsizetype &start, qsizetype &end)
+{
+    const qsizetype value = findTopLevelValue(object, key);
+    if (value < 0 || object.at(value) != '"') {
+        return false;
+    }
+    const qsizetype close = findClosingQuote(object, value);
+    if (close < 0) {
+        return false;
+    }
+    start = value + 1;
+    end = close;
+    return true;
+}
+
+/**
+ * @brief JSON 객체 텍스트에서 메시지 ID 찾기
+ * @details "request_id", 없으면 "response_id"의 정수 값을 찾습니다. 값을 찾으면 그 자리에서
+ *          멈추므로 ID가 앞쪽에 있는 보통의 메시지는 앞부분만 봅니다.
+ * @param object JSON 객체 텍스트
+ * @return 메시지 ID (없으면 0)
+ */
+int ImageStreamDecoder::findMessageId(const QByteArray &object)
+{
+    for (const QByteArray &key : {QByteArrayLiteral("request_id"), QByteArrayLiteral("response_id")}) {
+        const qsizetype value = findTopLevelValue(object, key);
+        if (value < 0) {
+            continue;
+        }
+        int messageId = 0;
+        for (qsizetype pos = value; pos < object.size() && std::isdigit(static_cast<uchar>(object.at(pos))); ++pos) {
+            if (messageId > 100000000) {
+                return 0;   // 비정상 값
+            }
+            messageId = messageId * 10 + (object.at(pos) - '0');
+        }
+        if (messageId != 0) {
+            return messageId;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief JSON 객체 텍스트에서 최상위 키의 값 시작 위치 찾기
+ * @param object JSON 객체 텍스트
+ * @param key 찾을 키 (이스케이프 없는 키만 비교)
+ * @return 값의 첫 바이트 위치 (없으면 -1)
+ */
+qsizetype ImageStreamDecoder::findTopLevelValue(const QByteArray &object, const QByteArray &key)
+{
+    const char *data = object.constData();
+    const qsizetype size = object.size();
+
+    int depth = 0;
+    bool expectKey = false;
+
+    for (qsizetype pos = 0; pos < size; ++pos) {
+        const char c = data[pos];
+        if (c == '"') {
+            const qsizetype close = findClosingQuote(object, pos);
+            if (close < 0) {
+                return -1;
+            }
+
+            if (depth == 1 && expectKey) {
+                expectKey = false;
+                if (close - pos - 1 == key.size()
+                    && std::memcmp(data + pos + 1, key.constData(), static_cast<size_t>(key.size())) == 0) {
+                    // 콜론과 공백 건너뛰기
+                    qsizetype value = close + 1;
+                    while (value < size && (data[value] == ':' || std::isspace(static_cast<uchar>(data[value])))) {
+                        ++value;
+                    }
+                    return value < size ? value : -1;
+                }
+            }
+            pos = close;
+            continue;
+        }
+
+        switch (c) {
+        case '{':
+        case '[':
+            if (depth == 0) {
+                if (c != '{') {
+                    return -1;
+                }
+                expectKey = true;
+            }
+            ++depth;
+            break;
+        case '}':
+        case ']':
+            if (--depth <= 0) {
+                return -1;
+            }
+            break;
+        case ',':
+            if (depth == 1) {
+                expectKey = true;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief 닫는 따옴표 위치 찾기
+ * @details 앞의 역슬래시가 홀수 개면 이스케이프된 따옴표로 보고 건너뜁니다.
+ * @param object JSON 텍스트
+ * @param open 여는 따옴표 위치
+ * @return 닫는 따옴표 위치 (없으면 -1)
+ */
+qsizetype ImageStreamDecoder::findClosingQuote(const QByteArray &object, qsizetype open)
+{
+    const char *data = object.constData();
+    const qsizetype size = object.size();
+
+    qsizetype close = open + 1;
+    for (;;) {
+        const char *quote = static_cast<const char *>(std::memchr(data + close, '"', static_cast<size_t>(size - close)));
+        if (!quote) {
+            return -1;
+        }
+        close = quote - data;
+        qsizetype backslashes = 0;
+        while (close - backslashes - 1 > open && data[close - backslashes - 1] == '\\') {
+            ++backslashes;
+        }
+        if (backslashes % 2 == 0) {
+            return close;
+        }
+        ++close;
+    }
+}
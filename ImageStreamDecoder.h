@@ -0,0 +1,182 @@
+#ifndef IMAGESTREAMDECODER_H
+#define IMAGESTREAMDECODER_H
+
+#include <QByteArray>
+#include <QList>
+#include <QPair>
+#include <QJsonObject>
+
+/**
+ * @brief 이미지 응답 스트리밍 디코더
+ * @details 길이 프리픽스 프레임의 페이로드를 도착하는 대로 받아 최상위 "data" 배열의
+ *          원소를 하나씩 잘라냅니다. 메시지 ID가 이미지 응답(10)으로 확인되면 완료된
+ *          원소만 넘기고 버퍼를 비우므로, 메모리 사용량이 전체 응답 크기가 아닌
+ *          이미지 한 장 크기에 비례합니다. 다른 메시지로 판명되면 전체 프레임을 모아 반환합니다.
+ *          메시지 ID가 "data" 배열 뒤에 오면 ID를 읽을 때까지 배열 전체를 보관합니다. 이 경우의
+ *          메모리는 FrameCodec이 메모리 상한으로 제한합니다 (상한 이하 프레임만 메모리에서 받고,
+ *          임시 파일 프레임은 ID 확인 전 보관량이 상한을 넘으면 거부).
+ */
+class ImageStreamDecoder
+{
+public:
+    /**
+     * @brief 디코더 동작 모드
+     */
+    enum class Mode {
+        Idle,           // 프레임 없음
+        Sniffing,       // 메시지 ID 확인 전 (전체 보관)
+        Streaming,      // 이미지 응답 확인 (원소 단위 방출)
+        Passthrough     // 다른 메시지 (전체 보관 후 반환)
+    };
+
+    /**
+     * @brief ImageStreamDecoder 생성자
+     * @param streamResponseId 스트리밍할 응답 ID
+     */
+    explicit ImageStreamDecoder(int streamResponseId = 10);
+
+    /**
+     * @brief 새 프레임 디코딩 시작
+     */
+    void begin();
+    /**
+     * @brief 페이로드 조각 입력
+     * @param data 수신된 페이로드 조각
+     */
+    void feed(const QByteArray &data);
+    /**
+     * @brief 현재 모드 반환
+     * @return 모드
+     */
+    Mode mode() const { return m_mode; }
+    /**
+     * @brief 스트리밍 모드 여부
+     * @return 이미지 응답으로 확인되었으면 true
+     */
+    bool isStreaming() const { return m_mode == Mode::Streaming; }
+    /**
+     * @brief 완료된 data[] 원소 가져오기
+     * @return 원소별 JSON 바이트 리스트
+     */
+    QList<QByteArray> takeElements();
+    /**
+     * @brief 최상위 필드 반환 ("data" 제외)
+     * @return 최상위 필드 객체
+     */
+    QJsonObject topLevelFields() const { return m_topLevelFields; }
+    /**
+     * @brief data[] 원소 하나의 최대 크기 설정
+     * @details 스트리밍 중 한 원소가 이 크기를 넘으면 보관하지 않고 건너뛰어, 디코더 버퍼가
+     *          원소 하나 크기 이상으로 커지지 않도록 합니다.
+     * @param maxBytes 최대 크기(바이트), 0 이하면 제한 없음
+     */
+    void setMaxElementBytes(qint64 maxBytes) { m_maxElementBytes = maxBytes; }
+    /**
+     * @brief 크기 초과로 건너뛴 원소 수 반환 (현재 프레임)
+     * @return 원소 수
+     */
+    int skippedElements() const { return m_skippedElements; }
+    /**
+     * @brief 보관 중인 버퍼 크기 반환 (아직 당기지 않은 소비 구간 포함)
+     * @return 바이트 수
+     */
+    qint64 bufferedBytes() const { return m_buffer.size(); }
+    /**
+     * @brief 프레임 디코딩 종료
+     * @return 스트리밍이 아니었던 경우 전체 프레임, 스트리밍이었으면 빈 배열
+     */
+    QByteArray finish();
+    /**
+     * @brief 상태 초기화
+     */
+    void reset();
+
+    /**
+     * @brief JSON 객체 텍스트에서 최상위 문자열 값의 위치 찾기
+     * @details 원소 JSON을 파싱하지 않고 값의 바이트 범위만 찾으므로, 큰 이미지 문자열을
+     *          QString으로 옮기지 않고 원소 버퍼에서 바로 디코딩할 수 있습니다.
+     *          이스케이프는 풀지 않으므로 범위에 '\'가 있으면 원문 그대로입니다.
+     * @param object JSON 객체 텍스트
+     * @param key 찾을 키 (이스케이프 없는 키만 비교)
+     * @param start 값 시작 위치 (여는 따옴표 다음)
+     * @param end 값 끝 위치 (닫는 따옴표, 미포함)
+     * @return 키가 있고 값이 문자열이면 true
+     */
+    static bool findStringValue(const QByteArray &object, const QByteArray &key, qsizetype &start, qsizetype &end);
+    /**
+     * @brief JSON 객체 텍스트에서 메시지 ID 찾기
+     * @details 파싱하지 않고 최상위 "request_id"(없으면 "response_id") 정수 값만 읽습니다.
+     * @param object JSON 객체 텍스트
+     * @return 메시지 ID (없으면 0)
+     */
+    static int findMessageId(const QByteArray &object);
+
+private:
+    /** @brief 최상위 키의 값 시작 위치 찾기 (없으면 -1) */
+    static qsizetype findTopLevelValue(const QByteArray &object, const QByteArray &key);
+    /** @brief 닫는 따옴표 위치 찾기 (없으면 -1) */
+    static qsizetype findClosingQuote(const QByteArray &object, qsizetype open);
+    /** @brief 버퍼 스캔 */
+    void scan();
+    /**
+     * @brief 문자열 내부 스캔
+     * @param pos 현재 위치
+     * @return 다음 스캔 위치
+     */
+    qint64 scanString(qint64 pos);
+    /**
+     * @brief 최상위 값 완료 처리
+     * @param start 값 시작 위치
+     * @param end 값 끝 위치 (미포함)
+     */
+    void onTopLevelValue(qint64 start, qint64 end);
+    /**
+     * @brief data[] 원소 완료 처리
+     * @param start 원소 시작 위치
+     * @param end 원소 끝 위치 (포함)
+     */
+    void onElement(qint64 start, qint64 end);
+    /** @brief 스트리밍 모드 전환 */
+    void enterStreaming();
+    /** @brief 소비한 앞부분 버퍼 정리 */
+    void trim();
+
+    /** @brief 스트리밍 대상 응답 ID */
+    int m_streamResponseId;
+    /** @brief 현재 모드 */
+    Mode m_mode;
+    /** @brief 미소비 페이로드 버퍼 */
+    QByteArray m_buffer;
+    /** @brief 스캔 위치 */
+    qint64 m_scanPos;
+    /** @brief 중첩 깊이 */
+    int m_depth;
+    /** @brief 문자열 내부 여부 */
+    bool m_inString;
+    /** @brief 이스케이프 직후 여부 */
+    bool m_escape;
+    /** @brief 최상위 키 대기 여부 */
+    bool m_expectKey;
+    /** @brief 최상위 키 시작 위치 */
+    qint64 m_keyStart;
+    /** @brief 현재 최상위 키 */
+    QByteArray m_currentKey;
+    /** @brief 최상위 값 시작 위치 */
+    qint64 m_valueStart;
+    /** @brief data 배열 내부 여부 */
+    bool m_inDataArray;
+    /** @brief 현재 원소 시작 위치 */
+    qint64 m_elementStart;
+    /** @brief 메시지 ID 확인 전 기록한 원소 범위 */
+    QList<QPair<qint64, qint64>> m_pendingSpans;
+    /** @brief 완료된 원소 리스트 */
+    QList<QByteArray> m_elements;
+    /** @brief 최상위 필드 */
+    QJsonObject m_topLevelFields;
+    /** @brief data[] 원소 최대 크기 (0 이하면 제한 없음) */
+    qint64 m_maxElementBytes;
+    /** @brief 크기 초과로 건너뛴 원소 수 */
+    int m_skippedElements;
+};
+
+#endif // IMAGESTREAMDECODER_H
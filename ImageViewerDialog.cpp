@@ -17,6 +17,7 @@ ImageViewerDialog::ImageViewerDialog(QWidget *parent)
     : QDialog(parent)
     , m_imageLabel(nullptr)
     , m_timestampLabel(nullptr)
+    , m_statusLabel(nullptr)
     , m_logTextEdit(nullptr)
     , m_scrollArea(nullptr)
 {
@@ -66,6 +67,11 @@ void ImageViewerDialog::setupUI()
 
     headerLayout->addStretch();
 
+    m_statusLabel = new QLabel();
+    m_statusLabel->setStyleSheet("font-size: 12px; color: #bbbbbb; padding: 10px;");
+    m_statusLabel->hide();
+    headerLayout->addWidget(m_statusLabel);
+
     mainLayout->addLayout(headerLayout);
 
     m_scrollArea = new QScrollArea();
@@ -154,3 +160,13 @@ void ImageViewerDialog::setImage(const QPixmap &pixmap, const QString &timestamp
     m_timestampLabel->setText(QString("촬영 시간: %1").arg(timestamp));
     m_logTextEdit->setPlainText(logText);
 }
+
+/**
+ * @brief 상태 문구 설정
+ * @param status 상태 문구 (빈 문자열이면 숨김)
+ */
+void ImageViewerDialog::setStatusText(const QString &status)
+{
+    m_statusLabel->setText(status);
+    m_statusLabel->setVisible(!status.isEmpty());
+}
@@ -31,6 +31,12 @@ public:
      * @param logText 로그 텍스트
      */
     void setImage(const QPixmap &pixmap, const QString &timestamp, const QString &logText);
+    /**
+     * @brief 상태 문구 설정
+     * @details 썸네일을 먼저 띄우고 원본을 받는 동안 진행 상태를 표시합니다.
+     * @param status 상태 문구 (빈 문자열이면 숨김)
+     */
+    void setStatusText(const QString &status);
 
 private:
     /** @brief UI 설정 함수 */
@@ -39,6 +45,8 @@ private:
     QLabel *m_imageLabel;
     /** @brief 타임스탬프 라벨 */
     QLabel *m_timestampLabel;
+    /** @brief 상태 라벨 (원본 수신 중 등) */
+    QLabel *m_statusLabel;
     /** @brief 로그 텍스트 에디터 */
     QTextEdit *m_logTextEdit;
     /** @brief 스크롤 영역 */
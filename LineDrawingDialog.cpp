@@ -1,6 +1,7 @@
 #include "LineDrawingDialog.h"
 #include "CustomMessageBox.h"
 #include "CustomTitleBar.h"
+#include "EnvConfig.h"
 
 #include <QApplication>
 #include <QMessageBox>
@@ -11,6 +12,9 @@
 #include <QGraphicsProxyWidget>
 #include <QInputDialog>
 #include <QToolTip>
+#include <QFuture>
+#include <QScreen>
+#include <utility>
 
 /**
  * @brief 생성자 (TCP 미사용)
@@ -42,6 +46,7 @@ LineDrawingDialog::LineDrawingDialog(const QString &rtspUrl, QWidget *parent)
     , m_roadLineSelectionMode(false)
     , m_tcpCommunicator(nullptr)
     , m_bboxEnabled(false)
+    , m_bboxTickTimer(nullptr)
     , m_roadLinesLoaded(false)
     , m_detectionLinesLoaded(false)
 {
@@ -52,6 +57,8 @@ LineDrawingDialog::LineDrawingDialog(const QString &rtspUrl, QWidget *parent)
 
     setupUI();
     setupMediaPlayer();
+    setupBBoxTick();
+    setupBBoxFilter();
 
     // 좌표별 클릭 연결
     connect(m_videoView, &VideoGraphicsView::coordinateClicked, this, &LineDrawingDialog::onCoordinateClicked);
@@ -95,6 +102,7 @@ LineDrawingDialog::LineDrawingDialog(const QString &rtspUrl, TcpCommunicator* tc
     , m_roadLineSelectionMode(false)
     , m_tcpCommunicator(tcpCommunicator)
     , m_bboxEnabled(false)
+    , m_bboxTickTimer(nullptr)
     , m_roadLinesLoaded(false)
     , m_detectionLinesLoaded(false)
 {
@@ -104,6 +112,8 @@ LineDrawingDialog::LineDrawingDialog(const QString &rtspUrl, TcpCommunicator* tc
 
     setupUI();
     setupMediaPlayer();
+    setupBBoxTick();
+    setupBBoxFilter();
 
     // 좌표별 클릭 연결
     connect(m_videoView, &VideoGraphicsView::coordinateClicked, this, &LineDrawingDialog::onCoordinateClicked);
@@ -127,8 +137,8 @@ void LineDrawingDialog::setTcpCommunicator(TcpCommunicator* communicator)
                   this, &LineDrawingDialog::onSavedRoadLinesReceived);
         disconnect(m_tcpCommunicator, &TcpCommunicator::savedDetectionLinesReceived,
                   this, &LineDrawingDialog::onSavedDetectionLinesReceived);
-        disconnect(m_tcpCommunicator, &TcpCommunicator::bboxesReceived,
-                  this, &LineDrawingDialog::onBBoxesReceived);
+        disconnect(m_tcpCommunicator, &TcpCommunicator::bboxFrameReady,
+                  this, &LineDrawingDialog::onBBoxFrameReady);
     }
 
     m_tcpCommunicator = communicator;
@@ -139,8 +149,8 @@ void LineDrawingDialog::setTcpCommunicator(TcpCommunicator* communicator)
                 this, &LineDrawingDialog::onSavedRoadLinesReceived);
         connect(m_tcpCommunicator, &TcpCommunicator::savedDetectionLinesReceived,
                 this, &LineDrawingDialog::onSavedDetectionLinesReceived);
-        connect(m_tcpCommunicator, &TcpCommunicator::bboxesReceived,
-                this, &LineDrawingDialog::onBBoxesReceived);
+        connect(m_tcpCommunicator, &TcpCommunicator::bboxFrameReady,
+                this, &LineDrawingDialog::onBBoxFrameReady);
         
         qDebug() << "LineDrawingDialog에 TcpCommunicator 설정 완료";
     }
@@ -171,8 +181,8 @@ void LineDrawingDialog::setupTcpConnection()
                 this, &LineDrawingDialog::onSavedDetectionLinesReceived);
 
         // BBox 데이터 수신 시그널 연결
-        connect(m_tcpCommunicator, &TcpCommunicator::bboxesReceived,
-                this, &LineDrawingDialog::onBBoxesReceived);
+        connect(m_tcpCommunicator, &TcpCommunicator::bboxFrameReady,
+                this, &LineDrawingDialog::onBBoxFrameReady);
 
         qDebug() << "TCP 통신 설정 완료";
     } else {
@@ -187,16 +197,19 @@ void LineDrawingDialog::setupTcpConnection()
 void LineDrawingDialog::requestSavedLinesFromServer()
 {
     if (m_tcpCommunicator && m_tcpCommunicator->isConnectedToServer()) {
-        // 도로선과 감지선을 따로 요청
-        bool roadSuccess = m_tcpCommunicator->requestSavedRoadLines();
-        bool detectionSuccess = m_tcpCommunicator->requestSavedDetectionLines();
-
-        if (roadSuccess && detectionSuccess) {
-            addLogMessage("서버에 저장된 도로선과 감지선 데이터를 자동으로 요청", "INFO");
-
-        } else {
-            addLogMessage("저장된 선 데이터 요청 실패", "ERROR");
-        }
+        // 도로선과 감지선을 따로 요청 (한 연결에서 파이프라이닝)
+        QList<QFuture<TcpResponse>> requests;
+        requests << m_tcpCommunicator->requestSavedRoadLines()
+                 << m_tcpCommunicator->requestSavedDetectionLines();
+        addLogMessage("서버에 저장된 도로선과 감지선 데이터를 자동으로 요청", "INFO");
+
+        QtFuture::whenAll(requests.begin(), requests.end())
+            .then(this, [this](QList<QFuture<TcpResponse>> results) {
+                QString failure = savedLinesRequestFailure(results);
+                if (!failure.isEmpty()) {
+                    addLogMessage("저장된 선 데이터 요청 실패 - " + failure, "ERROR");
+                }
+            });
     } else {
         addLogMessage("서버에 연결되어 있지 않아 저장된 선을 불러올 수 없음", "WARNING");
         // 연결이 안 되어 있으면 재시도
@@ -317,9 +330,9 @@ void LineDrawingDialog::checkAndLoadAllLines()
         if (m_videoView) {
             qDebug() << "모든 선 데이터 로드 완료";
 
-            // 즉시 선을 그리기
-            m_videoView->loadSavedDetectionLines(m_loadedDetectionLines);
+            // 즉시 선을 그리기 (도로선 로드가 기존 선을 지우므로 도로선 먼저)
             m_videoView->loadSavedRoadLines(m_loadedRoadLines);
+            m_videoView->loadSavedDetectionLines(m_loadedDetectionLines);
             qDebug() << "비디오 뷰에 저장된 선 데이터 로드 완료";
 
             addLogMessage("화면에 선 그리기 완료 - 얇은 선으로 표시됨", "SUCCESS");
@@ -1202,7 +1215,6 @@ void LineDrawingDialog::onLoadSavedLinesClicked()
         msgBox.exec();
         return;
     }
-    m_tcpCommunicator->setVideoView(m_videoView);
 
     addLogMessage("수동으로 저장된 선 데이터 요청", "ACTION");
 
@@ -1212,71 +1224,169 @@ void LineDrawingDialog::onLoadSavedLinesClicked()
     m_loadedRoadLines.clear();
     m_loadedDetectionLines.clear();
 
-    // 도로선과 감지선을 따로 요청
-    bool roadSuccess = m_tcpCommunicator->requestSavedRoadLines();
-    bool detectionSuccess = m_tcpCommunicator->requestSavedDetectionLines();
+    // 도로선과 감지선을 따로 요청 (한 연결에서 파이프라이닝)
+    QList<QFuture<TcpResponse>> requests;
+    requests << m_tcpCommunicator->requestSavedRoadLines()
+             << m_tcpCommunicator->requestSavedDetectionLines();
+
+    // 고정 지연 대신 두 응답(또는 타임아웃)이 모두 끝난 뒤 UI 갱신
+    QtFuture::whenAll(requests.begin(), requests.end())
+        .then(this, [this](QList<QFuture<TcpResponse>> results) {
+            updateCategoryInfo();
+            updateMappingInfo();
+            updateButtonStates();
+
+            QString failure = savedLinesRequestFailure(results);
+            if (failure.isEmpty()) {
+                addLogMessage("서버에 저장된 선 데이터 수신 완료", "SUCCESS");
+            } else {
+                addLogMessage("저장된 선 데이터 요청 실패 - " + failure, "ERROR");
+                CustomMessageBox msgBox(nullptr, "오류", "저장된 선 데이터 요청 실패\n" + failure);
+                msgBox.exec();
+            }
+        });
+}
+
+/**
+ * @brief 저장된 선 요청 결과 확인
+ * @param results 요청별 결과 future 리스트
+ * @return 실패 사유 (모두 성공하면 빈 문자열)
+ */
+QString LineDrawingDialog::savedLinesRequestFailure(const QList<QFuture<TcpResponse>> &results) const
+{
+    QStringList failures;
+    for (const auto &future : results) {
+        if (future.resultCount() == 0) {
+            failures << "요청 취소됨";
+            continue;
+        }
+        const TcpResponse response = future.result();
+        if (!response.success) {
+            failures << QString("request_id %1: %2").arg(response.requestId).arg(response.error);
+        }
+    }
+    return failures.join(", ");
+}
+
+/**
+ * @brief BBox 표시 주기 타이머 설정
+ * @details 서버가 화면 갱신보다 빠르게 BBox를 보내도 표시 주기마다 한 번만 그리도록 합니다.
+ */
+void LineDrawingDialog::setupBBoxTick()
+{
+    m_bboxTickTimer = new QTimer(this);
+    m_bboxTickTimer->setSingleShot(true);
+    m_bboxTickTimer->setTimerType(Qt::PreciseTimer);
+    connect(m_bboxTickTimer, &QTimer::timeout, this, &LineDrawingDialog::flushBBoxFrames);
+    m_bboxLastFlush.start();
+}
 
-    // 상단의 함수들이 완료되고 update 함수가 수행될 수 있도록 delay 0.5초
-    QEventLoop loop;
-    QTimer::singleShot(500, &loop, &QEventLoop::quit);
-    loop.exec();
+/**
+ * @brief .env에서 BBox 구독 필터 읽기
+ * @details 서버는 이 조건을 통과하는 BBox만 보내고, 화면도 같은 조건으로 그립니다.
+ *          BBOX_CLASSES는 쉼표로 구분한 클래스 이름, BBOX_MIN_CONFIDENCE는 백분율,
+ *          BBOX_ROI는 원본 영상 좌표의 "x,y,width,height"입니다 (비었으면 전체 화면).
+ */
+void LineDrawingDialog::setupBBoxFilter()
+{
+    m_bboxFilter = BBoxFilter();
 
+    const QStringList classNames = EnvConfig::getValue("BBOX_CLASSES", "Vehicle,Person,Human").split(',', Qt::SkipEmptyParts);
+    for (const QString &className : classNames) {
+        const ObjectClass objectClass = ObjectClassTable::intern(className.trimmed());
+        if (objectClass != ObjectClass::Unknown && !m_bboxFilter.classes.contains(objectClass)) {
+            m_bboxFilter.classes.append(objectClass);
+        }
+    }
 
-    updateCategoryInfo();
-    updateMappingInfo();
-    updateButtonStates();
+    m_bboxFilter.minConfidence = qBound(0, EnvConfig::getIntValue("BBOX_MIN_CONFIDENCE", 0), 100) / 100.0;
 
-    if (roadSuccess && detectionSuccess) {
-        addLogMessage("서버에 저장된 선 데이터 요청", "SUCCESS");
-    } else {
-        addLogMessage("저장된 선 데이터 요청 실패", "ERROR");
-        CustomMessageBox msgBox(nullptr, "오류", "저장된 선 데이터 요청 실패");
-        msgBox.exec();
+    const QStringList roi = EnvConfig::getValue("BBOX_ROI").split(',', Qt::SkipEmptyParts);
+    if (roi.size() == 4) {
+        m_bboxFilter.region = QRect(roi[0].trimmed().toInt(), roi[1].trimmed().toInt(),
+                                    roi[2].trimmed().toInt(), roi[3].trimmed().toInt());
+    } else if (!roi.isEmpty()) {
+        qDebug() << "[BBox] BBOX_ROI 형식 오류 (x,y,width,height) - 전체 화면 사용";
+    }
+
+    if (m_videoView) {
+        m_videoView->setBBoxFilter(m_bboxFilter);
     }
 }
 
 /**
- * @brief BBox 데이터 수신 슬롯
- * @param bboxes BBox 리스트
- * @param timestamp 타임스탬프
+ * @brief BBox 구독 필터를 요청 JSON으로 변환
+ * @return 필터 JSON 객체
  */
-void LineDrawingDialog::onBBoxesReceived(const QList<BBox> &bboxes, qint64 timestamp)
+QJsonObject LineDrawingDialog::bboxFilterToJson() const
 {
-    qDebug() << QString("Bounding Box 데이터 수신 - %1개 객체, 타임스탬프: %2").arg(bboxes.size()).arg(timestamp);
-    
-    // BBox가 비활성화되어 있다면 처리하지 않음
-    if (!m_bboxEnabled) {
-        qDebug() << "Bounding Box 비활성화";
+    QJsonArray classes;
+    for (ObjectClass objectClass : m_bboxFilter.classes) {
+        classes.append(ObjectClassTable::name(objectClass));
+    }
+
+    QJsonObject filter;
+    filter["classes"] = classes;
+    filter["min_confidence"] = m_bboxFilter.minConfidence;
+    if (!m_bboxFilter.region.isEmpty()) {
+        QJsonObject region;
+        region["x"] = m_bboxFilter.region.x();
+        region["y"] = m_bboxFilter.region.y();
+        region["width"] = m_bboxFilter.region.width();
+        region["height"] = m_bboxFilter.region.height();
+        filter["roi"] = region;
+    }
+    return filter;
+}
+
+/**
+ * @brief BBox 변경분 대기 알림 슬롯
+ * @param cameraId 카메라 ID
+ */
+void LineDrawingDialog::onBBoxFrameReady(const QString &cameraId)
+{
+    m_pendingBBoxCameras.insert(cameraId);
+    if (m_bboxTickTimer->isActive()) {
         return;
     }
-    
-    // VideoGraphicsView에 Bounding Box 전달
-    if (m_videoView) {
-        m_videoView->setBBoxes(bboxes, timestamp);
-        
-        // 로그 메시지 추가
-        if (bboxes.isEmpty()) {
 
-        } else {
-            QString objectList;
-            int filteredCount = 0;
-            for (const BBox &bbox : bboxes) {
-                // Vehicle과 Human(Person) 타입만 로그에 표시
-                QString lowerType = bbox.type.toLower();
-                if (lowerType == "vehicle" || lowerType == "person" || lowerType == "human") {
-                    objectList += QString("%1(%2%) ").arg(bbox.type).arg(static_cast<int>(bbox.confidence * 100));
-                    filteredCount++;
-                }
-            }
-            if (filteredCount > 0) {
+    // 직전 표시 후 한 주기가 지났으면 바로, 아니면 다음 주기에 꺼냄
+    const int tickMs = screen() && screen()->refreshRate() > 0 ? qRound(1000.0 / screen()->refreshRate()) : 16;
+    const qint64 remainingMs = tickMs - m_bboxLastFlush.elapsed();
+    if (remainingMs <= 0) {
+        flushBBoxFrames();
+    } else {
+        m_bboxTickTimer->start(static_cast<int>(remainingMs));
+    }
+}
 
-            } else {
+/**
+ * @brief 대기 중인 최신 BBox 변경분 화면 반영
+ */
+void LineDrawingDialog::flushBBoxFrames()
+{
+    m_bboxLastFlush.restart();
 
-            }
+    const QSet<QString> cameras = std::exchange(m_pendingBBoxCameras, QSet<QString>());
+    if (!m_tcpCommunicator) {
+        return;
+    }
+
+    for (const QString &cameraId : cameras) {
+        BBoxDelta delta;
+        qint64 timestamp = 0;
+        // 비활성화 상태에서도 꺼내서 우편함을 비워 둠
+        if (!m_tcpCommunicator->takeBBoxFrame(cameraId, &delta, &timestamp) || !m_bboxEnabled) {
+            continue;
+        }
+
+        // 바뀐 객체만 VideoGraphicsView에 반영
+        if (m_videoView) {
+            m_videoView->applyBBoxDelta(cameraId, delta, timestamp);
+        } else {
+            qDebug() << "VideoView null - Bounding Box 표시 불가";
+            addLogMessage("Bounding Box 표시 실패 - VideoView를 찾을 수 없음", "ERROR");
         }
-    } else {
-        qDebug() << "VideoView null - Bounding Box 표시 불가";
-        addLogMessage("Bounding Box 표시 실패 - VideoView를 찾을 수 없음", "ERROR");
     }
 }
 
@@ -1299,9 +1409,12 @@ void LineDrawingDialog::onBBoxOnClicked()
         QJsonObject bboxRequest;
         bboxRequest["request_id"] = 31;  // BBox 활성화
         bboxRequest["bbox_enabled"] = true;
+        // 구독 필터 - 서버는 그릴 BBox만 보냄 (구버전 서버는 무시하고 화면에서 걸러짐)
+        bboxRequest["filter"] = bboxFilterToJson();
         bool success = m_tcpCommunicator->sendJsonMessage(bboxRequest);
         if (success) {
-            qDebug() << "[BBox] ON 요청 전송 성공 (request_id: 31)";
+            qDebug() << "[BBox] ON 요청 전송 성공 (request_id: 31) - 필터:"
+                     << QJsonDocument(bboxRequest["filter"].toObject()).toJson(QJsonDocument::Compact);
         } else {
             qDebug() << "[BBox] ON 요청 전송 실패";
         }
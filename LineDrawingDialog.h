@@ -27,6 +27,8 @@
 #include <QButtonGroup>
 #include <QFrame>
 #include <QInputDialog>
+#include <QElapsedTimer>
+#include <QSet>
 
 class CustomTitleBar;
 
@@ -137,11 +139,12 @@ private slots:
 
     // BBox 관련 슬롯
     /**
-     * @brief BBox 데이터 수신 슬롯
-     * @param bboxes BBox 리스트
-     * @param timestamp 타임스탬프
+     * @brief BBox 변경분 대기 알림 슬롯
+     * @param cameraId 카메라 ID
      */
-    void onBBoxesReceived(const QList<BBox> &bboxes, qint64 timestamp);
+    void onBBoxFrameReady(const QString &cameraId);
+    /** @brief 대기 중인 최신 BBox 변경분 화면 반영 */
+    void flushBBoxFrames();
     /** @brief BBox ON 버튼 클릭 슬롯 */
     void onBBoxOnClicked();
     /** @brief BBox OFF 버튼 클릭 슬롯 */
@@ -181,6 +184,14 @@ private:
     QPushButton *m_bboxOffButton;
     /** @brief BBox 활성화 여부 */
     bool m_bboxEnabled;
+    /** @brief BBox 구독 필터 (BBOX_CLASSES, BBOX_MIN_CONFIDENCE, BBOX_ROI) */
+    BBoxFilter m_bboxFilter;
+    /** @brief BBox 표시 주기 타이머 */
+    QTimer *m_bboxTickTimer;
+    /** @brief 마지막 BBox 표시 후 경과 시간 */
+    QElapsedTimer m_bboxLastFlush;
+    /** @brief 꺼낼 변경분이 있는 카메라 ID */
+    QSet<QString> m_pendingBBoxCameras;
 
     // 로그 관련 UI
     /** @brief 로그 텍스트 에디트 */
@@ -280,6 +291,12 @@ private:
      * @brief 미디어 플레이어 설정
      */
     void setupMediaPlayer();
+    /** @brief BBox 표시 주기 타이머 설정 */
+    void setupBBoxTick();
+    /** @brief .env에서 BBox 구독 필터 읽기 */
+    void setupBBoxFilter();
+    /** @brief BBox 구독 필터를 요청 JSON으로 변환 */
+    QJsonObject bboxFilterToJson() const;
     /**
      * @brief 비디오 스트림 시작
      */
@@ -316,6 +333,12 @@ private:
      * @brief 모든 선 데이터 로드 확인
      */
     void checkAndLoadAllLines();
+    /**
+     * @brief 저장된 선 요청 결과 확인
+     * @param results 요청별 결과 future 리스트
+     * @return 실패 사유 (모두 성공하면 빈 문자열)
+     */
+    QString savedLinesRequestFailure(const QList<QFuture<TcpResponse>> &results) const;
 };
 
 #endif // LINEDRAWINGDIALOG_H
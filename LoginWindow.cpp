@@ -2,6 +2,7 @@
 #include "ui_LoginWindow.h"
 #include "MainWindow.h"
 #include "TcpCommunicator.h"
+#include "ConnectionManager.h"
 #include "EnvConfig.h"
 #include "CustomTitleBar.h"
 #include "CustomMessageBox.h"
@@ -19,6 +20,7 @@
 #include <QtSvg/QSvgRenderer>
 #include <QPainter>
 #include <QLabel>
+#include <QStandardPaths>
 
 /**
  * @brief LoginWindow 생성자
@@ -28,6 +30,8 @@
 LoginWindow::LoginWindow(QWidget *parent)
     : QDialog(parent)
     , ui(new Ui_LoginWindow)
+    , m_tcpCommunicator(nullptr)
+    , m_connectionManager(nullptr)
 {
     ui->setupUi(this);
     qDebug() << "[LoginWindow] 생성자 시작";
@@ -57,8 +61,41 @@ LoginWindow::LoginWindow(QWidget *parent)
     // 네트워크 설정 초기화
     m_tcpHost = EnvConfig::getValue("TCP_HOST", "192.168.0.81");
     m_tcpPort = EnvConfig::getValue("TCP_PORT", "8080").toUInt();
-    
-    qDebug() << "[LoginWindow] .env 설정 로드 - TCP_HOST:" << m_tcpHost << "TCP_PORT:" << m_tcpPort;
+
+    // TCP_HOSTS=host1:port,host2:port 가 있으면 순서대로 페일오버, 없으면 TCP_HOST:TCP_PORT 단일 서버
+    m_tcpEndpoints = TcpCommunicator::parseServerEndpoints(EnvConfig::getValue("TCP_HOSTS", ""), m_tcpPort);
+    if (m_tcpEndpoints.isEmpty()) {
+        m_tcpEndpoints.append(ServerEndpoint{m_tcpHost, m_tcpPort});
+    }
+
+    // 재시작 후에도 빠른 TLS 재연결을 위해 세션 티켓을 디스크에 보관 (선택)
+    if (EnvConfig::getBoolValue("TLS_SESSION_CACHE_DISK", false)) {
+        m_tlsSessionCacheFile = QStandardPaths::writableLocation(QStandardPaths::AppLocalDataLocation)
+                                + "/tls_session_cache.bin";
+    }
+
+    // 연결이 끊긴 동안의 선 편집을 디스크에 보관했다가 재연결 시 전송
+    if (EnvConfig::getBoolValue("OFFLINE_OUTBOX", true)) {
+        m_offlineOutboxFile = QStandardPaths::writableLocation(QStandardPaths::AppLocalDataLocation)
+                              + "/offline_outbox.jsonl";
+    }
+
+    // 이 크기(바이트) 이상의 송신 페이로드는 압축 (0이면 사용 안 함)
+    m_frameCompressionThreshold = EnvConfig::getIntValue("FRAME_COMPRESSION_THRESHOLD", 4096);
+
+    // 수신 프레임 크기 상한 - 하루치 이미지 응답이나 손상된 길이 헤더에도 메모리 사용량이 제한되도록 함
+    m_frameMemoryLimitBytes = qint64(EnvConfig::getIntValue("FRAME_MEMORY_LIMIT_MB", 32)) * 1024 * 1024;
+    m_frameMaxBytes = qint64(EnvConfig::getIntValue("FRAME_MAX_MB", 1024)) * 1024 * 1024;
+
+    // 이미지 응답의 base64 디코딩/파일 저장을 나눠 맡을 작업 스레드 수 (0이면 CPU 코어 수)
+    m_imageDecodeThreads = EnvConfig::getIntValue("IMAGE_DECODE_THREADS", 0);
+
+    // 반쯤 열린 연결 감지용 하트비트 (0이면 사용 안 함)
+    m_heartbeatIntervalMs = EnvConfig::getIntValue("HEARTBEAT_INTERVAL_MS", 15000);
+    m_heartbeatTimeoutMs = EnvConfig::getIntValue("HEARTBEAT_TIMEOUT_MS", 45000);
+
+    qDebug() << "[LoginWindow] .env 설정 로드 - TCP_HOST:" << m_tcpHost << "TCP_PORT:" << m_tcpPort
+             << "엔드포인트:" << m_tcpEndpoints.size() << "개";
 
     // 초기화 메서드 호출
     setupPasswordFields();
@@ -86,9 +123,6 @@ LoginWindow::LoginWindow(QWidget *parent)
     setModal(true);
     setWindowTitle("CCTV 모니터링 시스템 - 로그인");
 
-    // 연결 상태 확인 타이머 설정
-    setupConnectionTimer(); // 서버 구동시 주석해제
-
     qDebug() << "[LoginWindow] 생성자 완료";
 }
 
@@ -99,11 +133,6 @@ LoginWindow::~LoginWindow()
 {
     qDebug() << "[LoginWindow] 소멸자 호출";
 
-
-    if (m_connectionTimer) {
-        m_connectionTimer->stop();
-    }
-
     delete ui;
 
     qDebug() << "[LoginWindow] 소멸자 완료";
@@ -155,92 +184,162 @@ TcpCommunicator* LoginWindow::getTcpCommunicator() const
  */
 void LoginWindow::setTcpCommunicator(TcpCommunicator* communicator)
 {
+    if (m_tcpCommunicator == communicator) {
+        return;
+    }
+
     // 기존 연결 해제
-    if (m_tcpCommunicator && m_tcpCommunicator != communicator) {
-        disconnect(m_tcpCommunicator, &TcpCommunicator::connected,
-                  this, &LoginWindow::onTcpConnected);
-        disconnect(m_tcpCommunicator, &TcpCommunicator::disconnected,
-                  this, &LoginWindow::onTcpDisconnected);
-        disconnect(m_tcpCommunicator, &TcpCommunicator::errorOccurred,
-                  this, &LoginWindow::onTcpError);
-        disconnect(m_tcpCommunicator, &TcpCommunicator::messageReceived,
-                  this, &LoginWindow::onTcpMessageReceived);
+    if (m_tcpCommunicator) {
+        bindTcpSignals(m_tcpCommunicator, false);
+
+        // 생성자에서 만든 자체 통신기는 공유 통신기로 교체되면 더 이상 필요 없음
+        if (m_tcpCommunicator->parent() == this) {
+            m_tcpCommunicator->deleteLater();
+        }
     }
 
     m_tcpCommunicator = communicator;
 
     // 새로운 통신기에 시그널 연결
     if (m_tcpCommunicator) {
-        connect(m_tcpCommunicator, &TcpCommunicator::connected,
+        bindTcpSignals(m_tcpCommunicator, true);
+        configureTcpCommunicator(m_tcpCommunicator);
+        ensureServerConnection();
+    }
+}
+
+/**
+ * @brief 다중 사이트 연결 관리자 설정
+ * @param manager 연결 관리자
+ */
+void LoginWindow::setConnectionManager(ConnectionManager *manager)
+{
+    m_connectionManager = manager;
+    if (!m_connectionManager) {
+        return;
+    }
+
+    if (m_connectionManager->isEmpty()) {
+        for (const SiteConfig &config : ConnectionManager::sitesFromEnv(m_tcpEndpoints, m_tcpPort)) {
+            m_connectionManager->addSite(config);
+        }
+    }
+
+    // 로그인은 기본 사이트로 진행 (설정/연결은 setTcpCommunicator에서)
+    m_tcpEndpoints = m_connectionManager->siteConfig(m_connectionManager->primarySiteId()).endpoints;
+    setTcpCommunicator(m_connectionManager->primaryCommunicator());
+
+    // 보조 사이트는 각자 설정 후 독립적으로 연결
+    const QStringList siteIds = m_connectionManager->siteIds();
+    for (int i = 1; i < siteIds.size(); ++i) {
+        configureTcpCommunicator(m_connectionManager->communicator(siteIds.at(i)), siteIds.at(i));
+        m_connectionManager->ensureConnected(siteIds.at(i));
+    }
+}
+
+/**
+ * @brief TCP 통신기 시그널 연결/해제
+ * @param communicator 대상 통신기
+ * @param attach true면 연결, false면 해제
+ */
+void LoginWindow::bindTcpSignals(TcpCommunicator *communicator, bool attach)
+{
+    if (attach) {
+        connect(communicator, &TcpCommunicator::connected,
                 this, &LoginWindow::onTcpConnected);
-        connect(m_tcpCommunicator, &TcpCommunicator::disconnected,
+        connect(communicator, &TcpCommunicator::disconnected,
                 this, &LoginWindow::onTcpDisconnected);
-        connect(m_tcpCommunicator, &TcpCommunicator::errorOccurred,
+        connect(communicator, &TcpCommunicator::errorOccurred,
                 this, &LoginWindow::onTcpError);
-        connect(m_tcpCommunicator, &TcpCommunicator::messageReceived,
+        connect(communicator, &TcpCommunicator::messageReceived,
                 this, &LoginWindow::onTcpMessageReceived);
+        connect(communicator, &TcpCommunicator::connectionStateChanged,
+                this, &LoginWindow::onConnectionStateChanged);
+        connect(communicator, &TcpCommunicator::reconnectScheduled,
+                this, &LoginWindow::onReconnectScheduled);
+    } else {
+        disconnect(communicator, &TcpCommunicator::connected,
+                   this, &LoginWindow::onTcpConnected);
+        disconnect(communicator, &TcpCommunicator::disconnected,
+                   this, &LoginWindow::onTcpDisconnected);
+        disconnect(communicator, &TcpCommunicator::errorOccurred,
+                   this, &LoginWindow::onTcpError);
+        disconnect(communicator, &TcpCommunicator::messageReceived,
+                   this, &LoginWindow::onTcpMessageReceived);
+        disconnect(communicator, &TcpCommunicator::connectionStateChanged,
+                   this, &LoginWindow::onConnectionStateChanged);
+        disconnect(communicator, &TcpCommunicator::reconnectScheduled,
+                   this, &LoginWindow::onReconnectScheduled);
     }
 }
 
 /**
- * @brief 연결 상태 라벨 설정
+ * @brief .env 설정을 TCP 통신기에 적용
+ * @param communicator 대상 통신기
  */
-void LoginWindow::setupConnectionStatusLabel()
+void LoginWindow::configureTcpCommunicator(TcpCommunicator *communicator, const QString &siteId)
 {
-    // 연결 상태 표시 라벨 생성 (로그인 페이지 하단에)
-    m_connectionStatusLabel = new QLabel(ui->LoginPage);
-    m_connectionStatusLabel->setGeometry(40, 285, 200, 15); // 로그인 버튼 아래
-    m_connectionStatusLabel->show();
+    // 사이트별 통신기가 같은 파일을 덮어쓰지 않도록 보조 사이트는 파일을 분리
+    QString sessionCacheFile = m_tlsSessionCacheFile;
+    if (!sessionCacheFile.isEmpty() && !siteId.isEmpty()) {
+        sessionCacheFile.replace(".bin", QString("_%1.bin").arg(siteId));
+    }
+    communicator->setSessionCacheFile(sessionCacheFile);
+
+    QString offlineOutboxFile = m_offlineOutboxFile;
+    if (!offlineOutboxFile.isEmpty() && !siteId.isEmpty()) {
+        offlineOutboxFile.replace(".jsonl", QString("_%1.jsonl").arg(siteId));
+    }
+    communicator->setOfflineOutboxFile(offlineOutboxFile);
+    communicator->setCompressionThreshold(m_frameCompressionThreshold);
+    communicator->setFrameLimits(m_frameMemoryLimitBytes, m_frameMaxBytes);
+    communicator->setImageDecodeThreads(m_imageDecodeThreads);
+    communicator->setHeartbeat(m_heartbeatIntervalMs, m_heartbeatTimeoutMs);
 }
 
 /**
- * @brief 연결 상태 타이머 설정
+ * @brief 연결이 없으면 서버 연결 시작
+ * @details 연결 중/핸드셰이크 중인 시도는 그대로 두고, 끊겼거나 백오프 대기 중이면 즉시 다시 시도합니다.
  */
-void LoginWindow::setupConnectionTimer()
+void LoginWindow::ensureServerConnection()
 {
-    // 연결 상태 확인 타이머 (5초마다 확인)
-    m_connectionTimer = new QTimer(this);
-    m_connectionTimer->setInterval(5000); // 5초
-    connect(m_connectionTimer, &QTimer::timeout, this, &LoginWindow::checkConnectionStatus);
-    m_connectionTimer->start();
+    if (!m_tcpCommunicator) {
+        qDebug() << "[LoginWindow] TcpCommunicator가 초기화되지 않음";
+        return;
+    }
+
+    const ConnectionState state = m_tcpCommunicator->connectionState();
+    if (state == ConnectionState::Disconnected || state == ConnectionState::BackingOff) {
+        qDebug() << "[LoginWindow] 서버 연결 시도 - 엔드포인트" << m_tcpEndpoints.size() << "개";
+        m_tcpCommunicator->connectToServers(m_tcpEndpoints);
+    }
 }
 
 /**
- * @brief 연결 상태 확인
+ * @brief 연결 상태 라벨 갱신
+ * @param text 표시 문구
+ * @param color 글자색
  */
-void LoginWindow::checkConnectionStatus()
+void LoginWindow::updateConnectionStatusLabel(const QString &text, const QString &color)
 {
-    qDebug() << "[LoginWindow] 연결 상태 확인";
+    m_connectionStatusLabel->setText(text);
+    m_connectionStatusLabel->setStyleSheet(QString(
+        "QLabel {"
+        "    color: %1;"
+        "    font-size: 11px;"
+        "    background-color: transparent;"
+        "}").arg(color));
+}
 
-    if (m_tcpCommunicator) {
-        bool isConnected = m_tcpCommunicator->isConnectedToServer();
-        qDebug() << "[LoginWindow] TCP 연결 상태:" << isConnected;
-
-        if (isConnected) {
-            m_connectionStatusLabel->setText("서버 연결됨");
-            m_connectionStatusLabel->setStyleSheet(
-                "QLabel {"
-                "    color: #28a745;"
-                "    font-size: 11px;"
-                "    background-color: transparent;"
-                "}"
-                );
-        } else {
-            m_connectionStatusLabel->setText("서버 연결 끊어짐 - 재연결 시도 중...");
-            m_connectionStatusLabel->setStyleSheet(
-                "QLabel {"
-                "    color: #dc3545;"
-                "    font-size: 11px;"
-                "    background-color: transparent;"
-                "}"
-                );
-
-            // 재연결 시도
-            m_tcpCommunicator->connectToServer(m_tcpHost, m_tcpPort);
-        }
-    } else {
-        qDebug() << "[LoginWindow] TcpCommunicator가 초기화되지 않음";
-    }
+/**
+ * @brief 연결 상태 라벨 설정
+ */
+void LoginWindow::setupConnectionStatusLabel()
+{
+    // 연결 상태 표시 라벨 생성 (로그인 페이지 하단에)
+    m_connectionStatusLabel = new QLabel(ui->LoginPage);
+    m_connectionStatusLabel->setGeometry(40, 285, 200, 15); // 로그인 버튼 아래
+    m_connectionStatusLabel->show();
 }
 
 /**
@@ -338,28 +437,14 @@ void LoginWindow::setupTcpCommunication()
     m_tcpCommunicator = new TcpCommunicator(this);
 
     // TCP 시그널 연결
-    connect(m_tcpCommunicator, &TcpCommunicator::connected,
-            this, &LoginWindow::onTcpConnected);
-    connect(m_tcpCommunicator, &TcpCommunicator::disconnected,
-            this, &LoginWindow::onTcpDisconnected);
-    connect(m_tcpCommunicator, &TcpCommunicator::errorOccurred,
-            this, &LoginWindow::onTcpError);
-    connect(m_tcpCommunicator, &TcpCommunicator::messageReceived,
-            this, &LoginWindow::onTcpMessageReceived);
+    bindTcpSignals(m_tcpCommunicator, true);
+    configureTcpCommunicator(m_tcpCommunicator);
 
-    // 서버 연결 시도
-    qDebug() << "[LoginWindow] 서버 연결 시도:" << m_tcpHost << ":" << m_tcpPort;
-    m_tcpCommunicator->connectToServer(m_tcpHost, m_tcpPort);
+    // 연결 상태 업데이트 (연결 결과는 시그널로 비동기 전달)
+    updateConnectionStatusLabel("서버 연결 시도 중...", "#ffc107");
 
-    // 연결 상태 업데이트
-    m_connectionStatusLabel->setText("서버 연결 시도 중...");
-    m_connectionStatusLabel->setStyleSheet(
-        "QLabel {"
-        "    color: #ffc107;"
-        "    font-size: 11px;"
-        "    background-color: transparent;"
-        "}"
-        );
+    // 서버 연결 시도
+    ensureServerConnection();
 
     qDebug() << "[LoginWindow] TCP 통신 설정 완료";
 }
@@ -473,8 +558,8 @@ void LoginWindow::handleLogin()
         CustomMessageBox msgBox(nullptr, "연결 오류", "서버에 연결되지 않았습니다.\n잠시 후 다시 시도해주세요.");
         msgBox.exec();
 
-        // 재연결 시도
-        m_tcpCommunicator->connectToServer(m_tcpHost, m_tcpPort);
+        // 재연결 시도 (백오프 대기 중이면 즉시 재시도)
+        ensureServerConnection();
         return;
     }
 
@@ -544,8 +629,8 @@ void LoginWindow::handleSubmitSignUp()
         CustomMessageBox msgBox(nullptr, "연결 오류", "서버에 연결되지 않았습니다.\n잠시 후 다시 시도해주세요.");
         msgBox.exec();
 
-        // 재연결 시도
-        m_tcpCommunicator->connectToServer(m_tcpHost, m_tcpPort);
+        // 재연결 시도 (백오프 대기 중이면 즉시 재시도)
+        ensureServerConnection();
         return;
     }
 
@@ -775,14 +860,7 @@ void LoginWindow::onTcpConnected()
     qDebug() << "[LoginWindow] TCP 연결 성공";
 
     // 연결 상태 업데이트
-    m_connectionStatusLabel->setText("서버 연결됨");
-    m_connectionStatusLabel->setStyleSheet(
-        "QLabel {"
-        "    color: #28a745;"
-        "    font-size: 11px;"
-        "    background-color: transparent;"
-        "}"
-        );
+    updateConnectionStatusLabel("서버 연결됨", "#28a745");
 }
 
 /**
@@ -793,14 +871,7 @@ void LoginWindow::onTcpDisconnected()
     qDebug() << "[LoginWindow] TCP 연결 해제";
 
     // 연결 상태 업데이트
-    m_connectionStatusLabel->setText("서버 연결 끊어짐");
-    m_connectionStatusLabel->setStyleSheet(
-        "QLabel {"
-        "    color: #dc3545;"
-        "    font-size: 11px;"
-        "    background-color: transparent;"
-        "}"
-        );
+    updateConnectionStatusLabel("서버 연결 끊어짐", "#dc3545");
 
     // 사용자에게 알림 (한 번만)
     static bool disconnectNotified = false;
@@ -825,14 +896,7 @@ void LoginWindow::onTcpError(const QString &error)
     qDebug() << "[LoginWindow] TCP 오류:" << error;
 
     // 연결 상태 업데이트
-    m_connectionStatusLabel->setText("연결 오류 - 재시도 중...");
-    m_connectionStatusLabel->setStyleSheet(
-        "QLabel {"
-        "    color: #dc3545;"
-        "    font-size: 11px;"
-        "    background-color: transparent;"
-        "}"
-        );
+    updateConnectionStatusLabel("연결 오류 - 재시도 중...", "#dc3545");
 
     // 버튼 상태 복원
     resetLoginButton();
@@ -842,6 +906,44 @@ void LoginWindow::onTcpError(const QString &error)
     qDebug() << "[LoginWindow] 상세 오류 정보:" << error;
 }
 
+/**
+ * @brief TCP 연결 상태 변경 처리
+ * @param state 연결 상태
+ * @param endpoint 현재 엔드포인트 ("host:port")
+ */
+void LoginWindow::onConnectionStateChanged(ConnectionState state, const QString &endpoint)
+{
+    qDebug() << "[LoginWindow] TCP 연결 상태 변경:" << static_cast<int>(state) << endpoint;
+
+    switch (state) {
+    case ConnectionState::Connecting:
+        updateConnectionStatusLabel(QString("서버 연결 시도 중... (%1)").arg(endpoint), "#ffc107");
+        break;
+    case ConnectionState::Handshaking:
+        updateConnectionStatusLabel("보안 연결 설정 중...", "#ffc107");
+        break;
+    case ConnectionState::Disconnected:
+        updateConnectionStatusLabel("서버 연결 끊어짐", "#dc3545");
+        break;
+    case ConnectionState::Connected:
+    case ConnectionState::BackingOff:
+        // 연결됨은 onTcpConnected, 백오프는 onReconnectScheduled에서 표시
+        break;
+    }
+}
+
+/**
+ * @brief TCP 재연결 예약 처리
+ * @param delayMs 재연결까지 남은 시간(ms)
+ * @param attempt 재연결 라운드
+ */
+void LoginWindow::onReconnectScheduled(int delayMs, int attempt)
+{
+    qDebug() << "[LoginWindow] 재연결 예약:" << delayMs << "ms 후, 라운드" << attempt;
+    updateConnectionStatusLabel(QString("서버 연결 끊어짐 - %1초 후 재연결")
+                                    .arg(qMax(1, (delayMs + 500) / 1000)), "#dc3545");
+}
+
 /**
  * @brief TCP 메시지 수신 처리
  * @param message 수신 메시지
@@ -912,7 +1014,7 @@ void LoginWindow::handleLoginResponse(const QJsonObject &response)
             // 일반 사용자인 경우 로그인 성공
             CustomMessageBox msgBox(nullptr, "로그인 성공", "로그인에 성공했습니다.");
             msgBox.exec();
-            accept();
+            completeLogin();
         }
     } else {
         CustomMessageBox msgBox(nullptr, "로그인 실패", message.isEmpty() ? "로그인에 실패했습니다." : message);
@@ -921,6 +1023,19 @@ void LoginWindow::handleLoginResponse(const QJsonObject &response)
     }
 }
 
+/**
+ * @brief 로그인 완료 처리
+ * @details 다중 사이트 구성이면 나머지 사이트를 같은 자격 증명으로 인증한 뒤 창을 닫습니다.
+ * @param usedOtp OTP 인증을 거친 로그인 여부 (자동 재인증 불가)
+ */
+void LoginWindow::completeLogin(bool usedOtp)
+{
+    if (m_connectionManager) {
+        m_connectionManager->authenticate(m_currentUserId, m_currentPassword, usedOtp);
+    }
+    accept();
+}
+
 /**
  * @brief 회원가입 응답 처리
  * @param response 응답 객체
@@ -972,7 +1087,7 @@ void LoginWindow::handleOtpLoginResponse(const QJsonObject &response)
     if (success == 1) {
         CustomMessageBox msgBox(nullptr, "로그인 성공", message);
         msgBox.exec();
-        accept();
+        completeLogin(true);
     } else {
         CustomMessageBox msgBox(nullptr, "OTP 인증 실패", message.isEmpty() ? "OTP 인증에 실패했습니다." : message);
         msgBox.exec();
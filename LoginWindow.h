@@ -10,9 +10,11 @@
 #include <QTimer>
 #include <QJsonObject>
 
+#include "TcpCommunicator.h"
+
+class ConnectionManager;
 class QVBoxLayout;
 class CustomTitleBar;
-class TcpCommunicator;
 
 QT_BEGIN_NAMESPACE
 class Ui_LoginWindow;
@@ -66,6 +68,14 @@ public:
      * @param communicator TCP 통신 객체
      */
     void setTcpCommunicator(TcpCommunicator* communicator);
+    /**
+     * @brief 다중 사이트 연결 관리자 설정
+     * @details 관리자에 사이트가 없으면 .env(TCP_SITES)로 사이트를 추가하고, 기본 사이트 통신기를
+     *          로그인에 사용하며 나머지 사이트도 연결을 시작합니다. 로그인에 성공하면 나머지 사이트를
+     *          같은 자격 증명으로 인증합니다.
+     * @param manager 연결 관리자
+     */
+    void setConnectionManager(ConnectionManager *manager);
 
 private slots:
     // UI 이벤트 핸들러
@@ -88,10 +98,6 @@ private slots:
     /** @brief 비밀번호 변경 슬롯 */
     void onPasswordChanged();
 
-    // 연결 상태 확인
-    /** @brief 연결 상태 확인 슬롯 */
-    void checkConnectionStatus();
-
     // TCP 통신 관련 슬롯
     /** @brief TCP 연결 성공 슬롯 */
     void onTcpConnected();
@@ -107,6 +113,18 @@ private slots:
      * @param message 수신 메시지
      */
     void onTcpMessageReceived(const QString &message);
+    /**
+     * @brief TCP 연결 상태 변경 슬롯
+     * @param state 연결 상태
+     * @param endpoint 현재 엔드포인트 ("host:port")
+     */
+    void onConnectionStateChanged(ConnectionState state, const QString &endpoint);
+    /**
+     * @brief TCP 재연결 예약 슬롯
+     * @param delayMs 재연결까지 남은 시간(ms)
+     * @param attempt 재연결 라운드
+     */
+    void onReconnectScheduled(int delayMs, int attempt);
 
 private:
     /** @brief UI 객체 */
@@ -115,6 +133,8 @@ private:
     // TCP 통신
     /** @brief TCP 통신 객체 */
     TcpCommunicator *m_tcpCommunicator;
+    /** @brief 다중 사이트 연결 관리자 (없으면 단일 서버) */
+    ConnectionManager *m_connectionManager;
 
     // UI 컴포넌트
     /** @brief 비밀번호 오류 라벨 */
@@ -125,8 +145,6 @@ private:
     QPushButton *m_closeOtpSignUpButton;
     /** @brief 연결 상태 라벨 */
     QLabel *m_connectionStatusLabel;
-    /** @brief 연결 상태 확인 타이머 */
-    QTimer *m_connectionTimer;
 
     // 사용자 데이터
     /** @brief 현재 사용자 ID */
@@ -139,6 +157,24 @@ private:
     QString m_tcpHost;
     /** @brief TCP 포트 */
     quint16 m_tcpPort;
+    /** @brief 페일오버 순서의 서버 엔드포인트 (TCP_HOSTS) */
+    QList<ServerEndpoint> m_tcpEndpoints;
+    /** @brief TLS 세션 캐시 파일 경로 (TLS_SESSION_CACHE_DISK, 비어 있으면 메모리만) */
+    QString m_tlsSessionCacheFile;
+    /** @brief 오프라인 송신함 파일 경로 (OFFLINE_OUTBOX, 비어 있으면 사용 안 함) */
+    QString m_offlineOutboxFile;
+    /** @brief 프레임 압축 기준 크기 (FRAME_COMPRESSION_THRESHOLD, 0이면 사용 안 함) */
+    int m_frameCompressionThreshold;
+    /** @brief 메모리에 모을 수신 프레임 최대 크기 (FRAME_MEMORY_LIMIT_MB, 넘으면 임시 파일) */
+    qint64 m_frameMemoryLimitBytes;
+    /** @brief 수신 프레임 절대 상한 (FRAME_MAX_MB, 넘으면 연결 재설정) */
+    qint64 m_frameMaxBytes;
+    /** @brief 이미지 디코딩/저장 작업 스레드 수 (IMAGE_DECODE_THREADS, 0이면 CPU 코어 수) */
+    int m_imageDecodeThreads;
+    /** @brief 하트비트 주기(ms) (HEARTBEAT_INTERVAL_MS, 0이면 사용 안 함) */
+    int m_heartbeatIntervalMs;
+    /** @brief 하트비트 무응답 판정 시간(ms) (HEARTBEAT_TIMEOUT_MS) */
+    int m_heartbeatTimeoutMs;
 
     // 초기화 메서드
     /** @brief 패스워드 필드 설정 */
@@ -149,12 +185,32 @@ private:
     void setupCloseButtons();
     /** @brief 연결 상태 라벨 설정 */
     void setupConnectionStatusLabel();
-    /** @brief 연결 상태 타이머 설정 */
-    void setupConnectionTimer();
     /** @brief TCP 통신 설정 */
     void setupTcpCommunication();
     /** @brief 시그널 연결 */
     void connectSignals();
+    /**
+     * @brief TCP 통신기 시그널 연결/해제
+     * @param communicator 대상 통신기
+     * @param attach true면 연결, false면 해제
+     */
+    void bindTcpSignals(TcpCommunicator *communicator, bool attach);
+    /**
+     * @brief .env 설정을 TCP 통신기에 적용
+     * @param communicator 대상 통신기
+     * @param siteId 보조 사이트 ID (세션 캐시 파일을 사이트별로 분리, 기본 사이트는 빈 문자열)
+     */
+    void configureTcpCommunicator(TcpCommunicator *communicator, const QString &siteId = QString());
+    /** @brief 로그인 완료 처리 (보조 사이트 인증 후 창 닫기, usedOtp: OTP 인증을 거쳤는지) */
+    void completeLogin(bool usedOtp = false);
+    /** @brief 연결이 없으면 서버 연결 시작 (진행 중인 시도는 유지) */
+    void ensureServerConnection();
+    /**
+     * @brief 연결 상태 라벨 갱신
+     * @param text 표시 문구
+     * @param color 글자색
+     */
+    void updateConnectionStatusLabel(const QString &text, const QString &color);
 
     // TCP 통신 메서드
     /**
@@ -17,6 +17,10 @@
 #include <QComboBox>
 #include <QCalendarWidget>
 #include <QDialog>
+#include <QScrollBar>
+#include <algorithm>
+#include <iterator>
+#include <utility>
 
 // ClickableImageLabel 구현
 /**
@@ -36,13 +40,16 @@ ClickableImageLabel::ClickableImageLabel(QWidget *parent)
  * @param imagePath 이미지 경로
  * @param timestamp 타임스탬프
  * @param logText 로그 텍스트
+ * @param imageId 원본 이미지 ID (비어 있으면 imagePath가 원본)
  * @details 이미지와 관련된 데이터를 설정합니다.
  */
-void ClickableImageLabel::setImageData(const QString &imagePath, const QString &timestamp, const QString &logText)
+void ClickableImageLabel::setImageData(const QString &imagePath, const QString &timestamp, const QString &logText,
+                                       const QString &imageId)
 {
     m_imagePath = imagePath;
     m_timestamp = timestamp;
     m_logText = logText;
+    m_imageId = imageId;
 }
 
 /**
@@ -53,7 +60,7 @@ void ClickableImageLabel::setImageData(const QString &imagePath, const QString &
 void ClickableImageLabel::mousePressEvent(QMouseEvent *event)
 {
     if (event->button() == Qt::LeftButton) {
-        emit clicked(m_imagePath, m_timestamp, m_logText);
+        emit clicked(m_imagePath, m_timestamp, m_logText, m_imageId);
     }
     QLabel::mousePressEvent(event);
 }
@@ -68,12 +75,26 @@ MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
     , m_centralWidget(nullptr)
     , m_tabWidget(nullptr)
+    , m_linkStatsLabel(nullptr)
+    , m_siteHealthLabel(nullptr)
     , m_liveVideoTab(nullptr)
     , m_videoStreamWidget(nullptr)
     , m_capturedImageTab(nullptr)
     , m_imageScrollArea(nullptr)
     , m_imageGridWidget(nullptr)
     , m_imageGridLayout(nullptr)
+    , m_imageGridCount(0)
+    , m_imageStreamTarget(ImagePageTarget::Discard)
+    , m_imageQueryHour(-1)
+    , m_imagePageSize(20)
+    , m_imageTotalCount(-1)
+    , m_prefetchVisible(false)
+    , m_liveButton(nullptr)
+    , m_liveStatusLabel(nullptr)
+    , m_liveTimelineArea(nullptr)
+    , m_liveTimelineLayout(nullptr)
+    , m_liveTimelineCount(0)
+    , m_liveTimelineMax(30)
     , m_dateButton(nullptr)
     , m_hourComboBox(nullptr)
     , m_dateEdit(nullptr)
@@ -83,10 +104,10 @@ MainWindow::MainWindow(QWidget *parent)
     , m_tcpHost("")  // 빈 문자열로 초기화
     , m_tcpPort(0)   // 0으로 초기화
     , m_isConnected(false)
+    , m_connectionManager(nullptr)
     , m_tcpCommunicator(nullptr)
     , m_networkManager(nullptr)
     , m_updateTimer(nullptr)
-    , m_requestTimeoutTimer(nullptr)
     , m_imageViewerDialog(nullptr)
     , m_lineDrawingDialog(nullptr)
 {
@@ -99,6 +120,17 @@ MainWindow::MainWindow(QWidget *parent)
     m_rtspUrl = EnvConfig::getValue("RTSP_URL", "rtsp://192.168.0.81:8554/original"); // 2번째 인자는 기본값
     m_tcpHost = EnvConfig::getValue("TCP_HOST", "192.168.0.81");
     m_tcpPort = EnvConfig::getValue("TCP_PORT", "8080").toInt();
+    // 이 창이 보는 카메라 (다중 사이트 구성에서 요청을 보낼 사이트를 정함)
+    m_cameraId = EnvConfig::getValue("CAMERA_ID", "");
+    // 캡처 이미지 한 페이지 크기 (첫 페이지가 빨리 뜨도록 한 화면 남짓)
+    m_imagePageSize = qMax(2, EnvConfig::getIntValue("IMAGE_PAGE_SIZE", 20));
+    // 실시간 캡처 타임라인에 남겨 둘 최근 캡처 수
+    m_liveTimelineMax = qMax(1, EnvConfig::getIntValue("LIVE_TIMELINE_MAX", 30));
+
+    // 원본 이미지 캐시 (목록은 썸네일만 받고 원본은 뷰어에서 열 때 받아 보관)
+    const qint64 fullImageCacheBytes = qint64(EnvConfig::getIntValue("FULL_IMAGE_CACHE_MB", 256)) * 1024 * 1024;
+    m_fullImageCache.open(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/full_images",
+                          fullImageCacheBytes);
 
     qDebug() << "[MainWindow] .env 설정 로드됨 - RTSP:" << m_rtspUrl << "TCP:" << m_tcpHost << ":" << m_tcpPort;
 
@@ -138,9 +170,6 @@ MainWindow::~MainWindow()
     if (m_updateTimer) {
         m_updateTimer->stop();
     }
-    if (m_requestTimeoutTimer) {
-        m_requestTimeoutTimer->stop();
-    }
 }
 
 // TCP 통신기 설정 메서드
@@ -163,10 +192,29 @@ void MainWindow::setTcpCommunicator(TcpCommunicator* communicator)
                    this, &MainWindow::onTcpDataReceived);
         disconnect(m_tcpCommunicator, &TcpCommunicator::imagesReceived,
                    this, &MainWindow::onImagesReceived);
+        disconnect(m_tcpCommunicator, &TcpCommunicator::imageStreamStarted,
+                   this, &MainWindow::onImageStreamStarted);
+        disconnect(m_tcpCommunicator, &TcpCommunicator::imageReceived,
+                   this, &MainWindow::onImageReceived);
+        disconnect(m_tcpCommunicator, &TcpCommunicator::liveCaptureReceived,
+                   this, &MainWindow::onLiveCaptureReceived);
+        disconnect(m_tcpCommunicator, &TcpCommunicator::captureSubscriptionChanged,
+                   this, &MainWindow::onCaptureSubscriptionChanged);
+        // 실시간 구독은 새 통신기로 옮김
+        m_tcpCommunicator->setCaptureSubscription(false);
         disconnect(m_tcpCommunicator, &TcpCommunicator::coordinatesConfirmed,
                    this, &MainWindow::onCoordinatesConfirmed);
+        disconnect(m_tcpCommunicator, &TcpCommunicator::categorizedCoordinatesConfirmed,
+                   this, &MainWindow::onCategorizedCoordinatesConfirmed);
         disconnect(m_tcpCommunicator, &TcpCommunicator::statusUpdated,
                    this, &MainWindow::onStatusUpdated);
+        disconnect(m_tcpCommunicator, &TcpCommunicator::rttUpdated,
+                   this, &MainWindow::onRttUpdated);
+    }
+
+    // 선 편집/BBox도 같은 사이트로 보냄
+    if (m_lineDrawingDialog && m_tcpCommunicator != communicator) {
+        m_lineDrawingDialog->setTcpCommunicator(communicator);
     }
 
     m_tcpCommunicator = communicator;
@@ -183,11 +231,54 @@ void MainWindow::setTcpCommunicator(TcpCommunicator* communicator)
                 this, &MainWindow::onTcpDataReceived);
         connect(m_tcpCommunicator, &TcpCommunicator::imagesReceived,
                 this, &MainWindow::onImagesReceived);
+        connect(m_tcpCommunicator, &TcpCommunicator::imageStreamStarted,
+                this, &MainWindow::onImageStreamStarted);
+        connect(m_tcpCommunicator, &TcpCommunicator::imageReceived,
+                this, &MainWindow::onImageReceived);
+        connect(m_tcpCommunicator, &TcpCommunicator::liveCaptureReceived,
+                this, &MainWindow::onLiveCaptureReceived);
+        connect(m_tcpCommunicator, &TcpCommunicator::captureSubscriptionChanged,
+                this, &MainWindow::onCaptureSubscriptionChanged);
         connect(m_tcpCommunicator, &TcpCommunicator::coordinatesConfirmed,
                 this, &MainWindow::onCoordinatesConfirmed);
+        connect(m_tcpCommunicator, &TcpCommunicator::categorizedCoordinatesConfirmed,
+                this, &MainWindow::onCategorizedCoordinatesConfirmed);
         connect(m_tcpCommunicator, &TcpCommunicator::statusUpdated,
                 this, &MainWindow::onStatusUpdated);
+        connect(m_tcpCommunicator, &TcpCommunicator::rttUpdated,
+                this, &MainWindow::onRttUpdated);
+
+        if (m_liveButton && m_liveButton->isChecked()) {
+            m_tcpCommunicator->setCaptureSubscription(true);
+        }
+    }
+}
+
+/**
+ * @brief 다중 사이트 연결 관리자 설정
+ * @param manager 연결 관리자
+ * @details 카메라가 속한 사이트 통신기를 이 창의 통신기로 쓰고, 사이트 연결/인증 상태 시그널을 연결합니다.
+ */
+void MainWindow::setConnectionManager(ConnectionManager *manager)
+{
+    if (m_connectionManager) {
+        disconnect(m_connectionManager, nullptr, this, nullptr);
     }
+    m_connectionManager = manager;
+    if (!m_connectionManager) {
+        return;
+    }
+
+    connect(m_connectionManager, &ConnectionManager::healthChanged, this, &MainWindow::onSiteHealthChanged);
+    connect(m_connectionManager, &ConnectionManager::siteStateChanged, this, [this]() {
+        onSiteHealthChanged(m_connectionManager->connectedSiteCount(), m_connectionManager->siteIds().size());
+    });
+    connect(m_connectionManager, &ConnectionManager::siteAuthenticationFailed, this, &MainWindow::onSiteAuthenticationFailed);
+
+    const QString siteId = m_connectionManager->siteForCamera(m_cameraId);
+    qDebug() << "[MainWindow] 카메라" << (m_cameraId.isEmpty() ? "(기본)" : m_cameraId) << "-> 사이트" << siteId;
+    setTcpCommunicator(m_connectionManager->communicatorForCamera(m_cameraId));
+    onSiteHealthChanged(m_connectionManager->connectedSiteCount(), m_connectionManager->siteIds().size());
 }
 
 /**
@@ -230,6 +321,20 @@ void MainWindow::setupUI()
     setupLiveVideoTab();
     setupCapturedImageTab();
 
+    // 탭 오른쪽 위 사이트 연결 상태와 연결 품질 표시 (툴팁에 사이트별 상태, RTT 히스토그램)
+    QWidget *cornerWidget = new QWidget();
+    QHBoxLayout *cornerLayout = new QHBoxLayout(cornerWidget);
+    cornerLayout->setContentsMargins(0, 0, 0, 0);
+    cornerLayout->setSpacing(0);
+    m_siteHealthLabel = new QLabel();
+    m_siteHealthLabel->setStyleSheet("color: #999; font-size: 11px; padding: 0px 10px;");
+    m_siteHealthLabel->hide();
+    m_linkStatsLabel = new QLabel("RTT -");
+    m_linkStatsLabel->setStyleSheet("color: #999; font-size: 11px; padding: 0px 10px;");
+    cornerLayout->addWidget(m_siteHealthLabel);
+    cornerLayout->addWidget(m_linkStatsLabel);
+    m_tabWidget->setCornerWidget(cornerWidget, Qt::TopRightCorner);
+
 
     contentLayout->addWidget(m_tabWidget, 3);
 
@@ -468,7 +573,40 @@ void MainWindow::setupCapturedImageTab()
     topLayout->addWidget(m_requestButton);
     topLayout->addStretch(); // 오른쪽 여백 확보
 
+    // 실시간 캡처 상태 및 버튼 (켜면 서버가 새 경고 캡처를 바로 보내 줌)
+    m_liveStatusLabel = new QLabel();
+    m_liveStatusLabel->setStyleSheet("color: #bbbbbb; font-size: 11px;");
+    topLayout->addWidget(m_liveStatusLabel);
+
+    m_liveButton = new QPushButton("live");
+    m_liveButton->setCheckable(true);
+    m_liveButton->setStyleSheet(
+        "QPushButton { background-color: #383A41; color: white; padding: 6px 16px; border-radius: 4px; font-weight: bold; }"
+        "QPushButton:hover { background-color: #505360; }"
+        "QPushButton:checked { background-color: #f37321; }"
+        );
+    connect(m_liveButton, &QPushButton::toggled, this, &MainWindow::onLiveToggled);
+    topLayout->addWidget(m_liveButton);
+
     mainLayout->addWidget(topBar);
+
+    // 실시간 캡처 타임라인 (최신 캡처가 왼쪽, 실시간 모드에서만 표시)
+    m_liveTimelineArea = new QScrollArea();
+    m_liveTimelineArea->setWidgetResizable(true);
+    m_liveTimelineArea->setFixedHeight(160);
+    m_liveTimelineArea->setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    m_liveTimelineArea->setStyleSheet("QScrollArea { background-color: #383A41; border: none; border-radius: 10px; }");
+
+    QWidget *liveTimelineWidget = new QWidget();
+    liveTimelineWidget->setStyleSheet("background-color: #383A41;");
+    m_liveTimelineLayout = new QHBoxLayout(liveTimelineWidget);
+    m_liveTimelineLayout->setContentsMargins(10, 5, 10, 5);
+    m_liveTimelineLayout->setSpacing(10);
+    m_liveTimelineLayout->addStretch();
+
+    m_liveTimelineArea->setWidget(liveTimelineWidget);
+    m_liveTimelineArea->hide();
+    mainLayout->addWidget(m_liveTimelineArea);
     // 이미지 영역
     m_imageScrollArea = new QScrollArea();
     m_imageScrollArea->setWidgetResizable(true);
@@ -488,6 +626,10 @@ void MainWindow::setupCapturedImageTab()
     m_imageScrollArea->setWidget(m_imageGridWidget);
     mainLayout->addWidget(m_imageScrollArea);
 
+    // 끝 부근까지 내리면 미리 받아 둔 다음 페이지 표시 (추가로 범위가 바뀌어도 다시 확인)
+    connect(m_imageScrollArea->verticalScrollBar(), &QScrollBar::valueChanged, this, &MainWindow::onImageScrolled);
+    connect(m_imageScrollArea->verticalScrollBar(), &QScrollBar::rangeChanged, this, &MainWindow::onImageScrolled);
+
     m_tabWidget->addTab(m_capturedImageTab, "Captured Images");
 
     m_imageViewerDialog = new ImageViewerDialog(this);
@@ -515,18 +657,18 @@ void MainWindow::setupNetworkConnection()
         connect(m_tcpCommunicator, &TcpCommunicator::errorOccurred, this, &MainWindow::onTcpError);
         connect(m_tcpCommunicator, &TcpCommunicator::messageReceived, this, &MainWindow::onTcpDataReceived);
         connect(m_tcpCommunicator, &TcpCommunicator::imagesReceived, this, &MainWindow::onImagesReceived);
+        connect(m_tcpCommunicator, &TcpCommunicator::imageStreamStarted, this, &MainWindow::onImageStreamStarted);
+        connect(m_tcpCommunicator, &TcpCommunicator::imageReceived, this, &MainWindow::onImageReceived);
+        connect(m_tcpCommunicator, &TcpCommunicator::liveCaptureReceived, this, &MainWindow::onLiveCaptureReceived);
+        connect(m_tcpCommunicator, &TcpCommunicator::captureSubscriptionChanged, this, &MainWindow::onCaptureSubscriptionChanged);
 
         // 새로운 JSON 기반 시그널 연결
         connect(m_tcpCommunicator, &TcpCommunicator::coordinatesConfirmed, this, &MainWindow::onCoordinatesConfirmed);
+        connect(m_tcpCommunicator, &TcpCommunicator::categorizedCoordinatesConfirmed, this, &MainWindow::onCategorizedCoordinatesConfirmed);
         connect(m_tcpCommunicator, &TcpCommunicator::statusUpdated, this, &MainWindow::onStatusUpdated);
+        connect(m_tcpCommunicator, &TcpCommunicator::rttUpdated, this, &MainWindow::onRttUpdated);
     }
 
-    // 이미지 요청 타임아웃 타이머 설정
-    m_requestTimeoutTimer = new QTimer(this);
-    m_requestTimeoutTimer->setSingleShot(true);
-    m_requestTimeoutTimer->setInterval(30000);
-    connect(m_requestTimeoutTimer, &QTimer::timeout, this, &MainWindow::onRequestTimeout);
-
 }
 
 /**
@@ -550,6 +692,7 @@ void MainWindow::clearImageGrid()
         delete item->widget();
         delete item;
     }
+    m_imageGridCount = 0;
 }
 
 /**
@@ -569,60 +712,81 @@ void MainWindow::displayImages(const QList<ImageData> &images)
         return;
     }
 
-    int row = 0;
-    int col = 0;
-
     for (const ImageData &imageData : images) {
-        ClickableImageLabel *imageLabel = new ClickableImageLabel();
-        imageLabel->setFixedSize(300, 200);
-        imageLabel->setScaledContents(true);
-        imageLabel->setImageData(imageData.imagePath, imageData.timestamp, imageData.logText);
-        imageLabel->setStyleSheet("border: none; padding: 2px; margin:0px");
-
-        QPixmap pixmap;
-        if (pixmap.load(imageData.imagePath)) {
-            imageLabel->setPixmap(pixmap);
-        } else {
-            imageLabel->setText("이미지 로드 실패");
-            imageLabel->setStyleSheet(imageLabel->styleSheet() + " color: #999;");
-        }
-
-        QLabel *timeLabel = new QLabel(imageData.timestamp);
-        timeLabel->setAlignment(Qt::AlignCenter);
-        timeLabel->setStyleSheet("background-color: #383A41; color: white; padding: 5px; font-size: 12px;");
-
-        QWidget *container = new QWidget();
-        container->setFixedSize(320, 240);
-
-        // 이미지 스타일 적용
-        container->setStyleSheet(
-            "background-color: #383A41;"
-            "border-radius: 10px;"
-            "padding: 5px;"
-            );
-        QVBoxLayout *containerLayout = new QVBoxLayout(container);
-        containerLayout->setContentsMargins(5, 5, 5, 5);
-        containerLayout->setSpacing(8);
-
-        //가운데 정렬
-        containerLayout->addStretch(1);          // 위쪽 여백
-        containerLayout->addWidget(imageLabel, 0, Qt::AlignHCenter);
-        containerLayout->addStretch(1);          // 아래쪽 여백
-        containerLayout->addWidget(timeLabel, 0, Qt::AlignHCenter);
-        connect(imageLabel, &ClickableImageLabel::clicked, this, &MainWindow::onImageClicked);
-
-        m_imageGridLayout->addWidget(container, row, col);
-
-        col++;
-        if (col >= 2) {
-            col = 0;
-            row++;
-        }
+        addImageToGrid(imageData);
     }
 
     m_imageGridWidget->adjustSize();
 }
 
+/**
+ * @brief 이미지 한 장을 그리드 끝에 추가
+ * @param imageData 이미지 데이터
+ * @details 스트리밍 수신 시 도착한 순서대로 2열 그리드에 이어 붙입니다.
+ */
+void MainWindow::addImageToGrid(const ImageData &imageData)
+{
+    ClickableImageLabel *imageLabel = createImageLabel(imageData, QSize(300, 200));
+
+    QLabel *timeLabel = new QLabel(imageData.timestamp);
+    timeLabel->setAlignment(Qt::AlignCenter);
+    timeLabel->setStyleSheet("background-color: #383A41; color: white; padding: 5px; font-size: 12px;");
+
+    QWidget *container = new QWidget();
+    container->setFixedSize(320, 240);
+
+    // 이미지 스타일 적용
+    container->setStyleSheet(
+        "background-color: #383A41;"
+        "border-radius: 10px;"
+        "padding: 5px;"
+        );
+    QVBoxLayout *containerLayout = new QVBoxLayout(container);
+    containerLayout->setContentsMargins(5, 5, 5, 5);
+    containerLayout->setSpacing(8);
+
+    //가운데 정렬
+    containerLayout->addStretch(1);          // 위쪽 여백
+    containerLayout->addWidget(imageLabel, 0, Qt::AlignHCenter);
+    containerLayout->addStretch(1);          // 아래쪽 여백
+    containerLayout->addWidget(timeLabel, 0, Qt::AlignHCenter);
+
+    int row = m_imageGridCount / 2;
+    int col = m_imageGridCount % 2;
+    m_imageGridLayout->addWidget(container, row, col);
+    m_imageGridCount++;
+}
+
+/**
+ * @brief 캡처 이미지 라벨 생성 (그리드/실시간 타임라인 공용)
+ * @param imageData 이미지 데이터
+ * @param size 라벨 크기
+ * @return 클릭하면 뷰어를 여는 이미지 라벨
+ */
+ClickableImageLabel *MainWindow::createImageLabel(const ImageData &imageData, const QSize &size)
+{
+    ClickableImageLabel *imageLabel = new ClickableImageLabel();
+    imageLabel->setFixedSize(size);
+    imageLabel->setScaledContents(true);
+    imageLabel->setImageData(imageData.imagePath, imageData.timestamp, imageData.logText, imageData.imageId);
+    imageLabel->setStyleSheet("border: none; padding: 2px; margin:0px");
+
+    QPixmap pixmap;
+    if (pixmap.load(imageData.imagePath)) {
+        // 원본을 보내는 구버전 서버라도 표시 크기로 줄여 보관 (뷰어는 파일에서 다시 읽음)
+        const QSize displaySize = imageLabel->size() * imageLabel->devicePixelRatioF();
+        if (pixmap.width() > displaySize.width() || pixmap.height() > displaySize.height()) {
+            pixmap = pixmap.scaled(displaySize, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+        }
+        imageLabel->setPixmap(pixmap);
+    } else {
+        imageLabel->setText("이미지 로드 실패");
+        imageLabel->setStyleSheet(imageLabel->styleSheet() + " color: #999;");
+    }
+    connect(imageLabel, &ClickableImageLabel::clicked, this, &MainWindow::onImageClicked);
+    return imageLabel;
+}
+
 /**
  * @brief 비디오 스트림 클릭 슬롯
  * @details 스트리밍 중일 때 라인 드로잉 다이얼로그를 실행합니다.
@@ -720,10 +884,228 @@ void MainWindow::onRequestImagesClicked()
     int selectedHour = m_hourComboBox->currentData().toInt();
     QString dateString = m_selectedDate.toString("yyyy-MM-dd");
 
-    // JSON 기반 이미지 요청
-    m_tcpCommunicator->requestImageData(dateString, selectedHour);
+    // 이전 조회의 응답이 아직 오고 있으면 무시하도록 표시
+    for (ImagePageRequest &request : m_imagePageRequests) {
+        request.target = ImagePageTarget::Discard;
+    }
+    m_imageStreamTarget = ImagePageTarget::Discard;
+
+    m_imageQueryDate = dateString;
+    m_imageQueryHour = selectedHour;
+    m_imageNextCursor.clear();
+    m_imageTotalCount = -1;
+    m_prefetchedImages.clear();
+    m_prefetchVisible = false;
+
+    // 첫 페이지만 요청 (응답 마감 30초, 이미지는 imageReceived로 먼저 표시됨)
+    m_requestButton->setEnabled(false);
+    quint32 seq = 0;
+    QFuture<TcpResponse> future =
+        m_tcpCommunicator->requestImagePage(dateString, selectedHour, m_imagePageSize, QString(), 30000, &seq);
+    m_imagePageRequests.append({seq, ImagePageTarget::Replace});
+    future.then(this, [this, seq](TcpResponse response) {
+        onImagePageFinished(seq, response);
+    });
+
+    qDebug() << QString("JSON 이미지 요청: %1, %2시~%3시 (페이지 %4장)")
+                    .arg(dateString).arg(selectedHour).arg(selectedHour + 1).arg(m_imagePageSize);
+}
+
+/**
+ * @brief 이미지 페이지 요청 완료 처리
+ * @param seq 요청의 상관 ID
+ * @param response 요청 결과
+ * @details 다음 페이지 커서를 갱신하고, 첫 페이지 뒤에는 다음 페이지를 백그라운드로 미리 받습니다.
+ *          시간 초과로 먼저 끝난 요청도 상관 ID로 찾으므로 다른 요청의 자리를 차지하지 않습니다.
+ */
+void MainWindow::onImagePageFinished(quint32 seq, const TcpResponse &response)
+{
+    const auto request = std::find_if(m_imagePageRequests.begin(), m_imagePageRequests.end(),
+                                      [seq](const ImagePageRequest &pending) { return pending.seq == seq; });
+    if (request == m_imagePageRequests.end()) {
+        return;
+    }
+    const ImagePageTarget target = request->target;
+    m_imagePageRequests.erase(request);
+    if (target == ImagePageTarget::Discard) {
+        return;
+    }
+
+    if (target == ImagePageTarget::Replace) {
+        m_requestButton->setEnabled(m_isConnected);
+    }
+
+    if (!response.success) {
+        if (target == ImagePageTarget::Replace && response.timedOut) {
+            onRequestTimeout();
+        } else {
+            // 다음 페이지 실패는 커서를 그대로 두고 다음 스크롤에서 다시 요청
+            qDebug() << "이미지 페이지 요청 실패:" << (response.timedOut ? "응답 시간 초과" : response.error);
+        }
+        return;
+    }
+
+    const ImagePageInfo page = TcpCommunicator::imagePageInfo(response);
+    m_imageNextCursor = page.nextCursor;
+    if (page.totalCount >= 0) {
+        m_imageTotalCount = page.totalCount;
+    }
+
+    qDebug() << QString("이미지 페이지 수신 - 표시 %1장, 보관 %2장, 전체 %3, 다음 페이지 %4 (지연 %5ms)")
+                    .arg(m_imageGridCount).arg(m_prefetchedImages.size())
+                    .arg(m_imageTotalCount >= 0 ? QString::number(m_imageTotalCount) : QString("?"))
+                    .arg(page.hasMore() ? "있음" : "없음").arg(response.latencyMs);
+
+    // 첫 페이지나 이미 화면에 보이는 페이지 뒤에는 다음 페이지를 미리 받아 둠
+    // (보관만 한 페이지는 스크롤로 표시될 때 그다음 페이지를 요청)
+    if (target == ImagePageTarget::Replace || m_prefetchVisible) {
+        requestNextImagePage(isImageScrollNearEnd());
+    }
+}
+
+/**
+ * @brief 다음 이미지 페이지 요청
+ * @param showOnArrival 받는 즉시 그리드에 표시할지 여부 (false면 미리 받아 보관)
+ */
+void MainWindow::requestNextImagePage(bool showOnArrival)
+{
+    if (!m_tcpCommunicator || m_imageNextCursor.isEmpty() || isImagePageInFlight()
+        || !m_tcpCommunicator->isConnectedToServer()) {
+        return;
+    }
+
+    m_prefetchVisible = showOnArrival;
+    quint32 seq = 0;
+    QFuture<TcpResponse> future = m_tcpCommunicator->requestImagePage(m_imageQueryDate, m_imageQueryHour, m_imagePageSize,
+                                                                      m_imageNextCursor, 30000, &seq);
+    m_imagePageRequests.append({seq, ImagePageTarget::Prefetch});
+    future.then(this, [this, seq](TcpResponse response) {
+        onImagePageFinished(seq, response);
+    });
+}
+
+/**
+ * @brief 응답 대기 중인 이미지 페이지 요청이 있는지 여부
+ * @return 있으면 true
+ */
+bool MainWindow::isImagePageInFlight() const
+{
+    return std::any_of(m_imagePageRequests.cbegin(), m_imagePageRequests.cend(),
+                       [](const ImagePageRequest &request) { return request.target != ImagePageTarget::Discard; });
+}
+
+/**
+ * @brief 이미지 스크롤이 끝 부근인지 여부
+ * @return 마지막 줄 근처이거나 스크롤할 내용이 없으면 true
+ */
+bool MainWindow::isImageScrollNearEnd() const
+{
+    const QScrollBar *scrollBar = m_imageScrollArea->verticalScrollBar();
+    // 이미지 한 줄(컨테이너 240px) 남았을 때부터 다음 페이지를 붙임
+    return scrollBar->maximum() - scrollBar->value() <= 240;
+}
+
+/**
+ * @brief 이미지 스크롤 위치/범위 변경 슬롯
+ * @details 끝 부근에 닿으면 미리 받아 둔 페이지를 붙이고, 진행 중인 페이지는 도착 즉시 표시하도록
+ *          바꾸며, 그다음 페이지를 백그라운드로 요청합니다.
+ */
+void MainWindow::onImageScrolled()
+{
+    if (!isImageScrollNearEnd()) {
+        return;
+    }
+
+    if (!m_prefetchedImages.isEmpty()) {
+        const QList<ImageData> images = std::exchange(m_prefetchedImages, {});
+        for (const ImageData &image : images) {
+            addImageToGrid(image);
+        }
+        m_imageGridWidget->adjustSize();
+    }
+
+    if (isImagePageInFlight()) {
+        m_prefetchVisible = true;
+    } else {
+        requestNextImagePage(false);
+    }
+}
+
+/**
+ * @brief 실시간 캡처 버튼 토글 슬롯
+ * @param checked 실시간 모드 여부
+ * @details 켜면 서버에 캡처 푸시를 구독하고 타임라인을 표시합니다. 끄면 구독을 해지하지만
+ *          이미 받은 캡처는 다시 켰을 때 이어서 볼 수 있도록 남겨 둡니다.
+ */
+void MainWindow::onLiveToggled(bool checked)
+{
+    m_liveTimelineArea->setVisible(checked);
+    m_liveStatusLabel->setText(checked ? "실시간 연결 중..." : QString());
+
+    if (m_tcpCommunicator) {
+        m_tcpCommunicator->setCaptureSubscription(checked);
+    }
+}
+
+/**
+ * @brief 실시간 캡처 수신 슬롯
+ * @param image 캡처 이미지 데이터 (썸네일)
+ * @details 시간대를 다시 조회하지 않고 타임라인 맨 앞에 한 장만 추가하며, 최대 수를 넘으면
+ *          가장 오래된 캡처를 지웁니다.
+ */
+void MainWindow::onLiveCaptureReceived(const ImageData &image)
+{
+    if (!m_liveButton->isChecked()) {
+        return;
+    }
+
+    ClickableImageLabel *imageLabel = createImageLabel(image, QSize(150, 100));
+
+    QLabel *timeLabel = new QLabel(image.timestamp);
+    timeLabel->setAlignment(Qt::AlignCenter);
+    timeLabel->setStyleSheet("color: white; font-size: 11px;");
+
+    QWidget *container = new QWidget();
+    container->setFixedSize(160, 140);
+    QVBoxLayout *containerLayout = new QVBoxLayout(container);
+    containerLayout->setContentsMargins(5, 5, 5, 5);
+    containerLayout->setSpacing(4);
+    containerLayout->addWidget(imageLabel, 0, Qt::AlignHCenter);
+    containerLayout->addWidget(timeLabel, 0, Qt::AlignHCenter);
+
+    m_liveTimelineLayout->insertWidget(0, container);
+    m_liveTimelineCount++;
+
+    // 가장 오래된 캡처 제거 (마지막 항목은 오른쪽 여백 stretch)
+    while (m_liveTimelineCount > m_liveTimelineMax) {
+        QLayoutItem *item = m_liveTimelineLayout->takeAt(m_liveTimelineLayout->count() - 2);
+        delete item->widget();
+        delete item;
+        m_liveTimelineCount--;
+    }
+
+    m_liveTimelineArea->horizontalScrollBar()->setValue(0);
+    m_liveStatusLabel->setText(QString("실시간 - 최근 캡처 %1").arg(image.timestamp));
+}
+
+/**
+ * @brief 실시간 캡처 구독 상태 변경 슬롯
+ * @param active 서버가 구독을 받았는지 여부
+ * @param message 상태 메시지
+ */
+void MainWindow::onCaptureSubscriptionChanged(bool active, const QString &message)
+{
+    qDebug() << "실시간 캡처 구독 상태:" << active << message;
+
+    if (!m_liveButton->isChecked()) {
+        return;
+    }
 
-    qDebug() << QString("JSON 이미지 요청: %1, %2시~%3시").arg(dateString).arg(selectedHour).arg(selectedHour + 1);
+    if (active) {
+        m_liveStatusLabel->setText("실시간 수신 중");
+    } else {
+        m_liveStatusLabel->setText(message.isEmpty() ? "실시간 구독 실패" : message);
+    }
 }
 
 /**
@@ -757,6 +1139,11 @@ void MainWindow::onTcpDisconnected()
     if (m_requestButton) {
         m_requestButton->setEnabled(false);
     }
+
+    // 재연결되면 통신기가 자동으로 다시 구독
+    if (m_liveButton && m_liveButton->isChecked()) {
+        m_liveStatusLabel->setText("실시간 연결 끊김 - 재연결 대기 중");
+    }
 }
 
 /**
@@ -809,29 +1196,122 @@ void MainWindow::onImagesReceived(const QList<ImageData> &images)
 {
     qDebug() << QString("이미지 리스트 수신: %1개").arg(images.size());
 
-    if (m_requestTimeoutTimer->isActive()) {
-        m_requestTimeoutTimer->stop();
+    // 다음 페이지는 onImageReceived에서 보관/표시가 끝남
+    if (m_imageStreamTarget != ImagePageTarget::Replace) {
+        return;
     }
 
-    displayImages(images);
+    // 이미지는 onImageReceived에서 이미 그리드에 추가됨
+    if (images.isEmpty() || m_imageGridCount == 0) {
+        displayImages(images);
+    } else {
+        m_imageGridWidget->adjustSize();
+    }
 
     m_requestButton->setEnabled(true);
 }
 
+/**
+ * @brief 이미지 응답 수신 시작 슬롯
+ * @param seq 응답의 상관 ID (모르면 0)
+ * @details 상관 ID가 같은 대기 요청의 대상으로 표시하며, 첫 페이지 응답이 시작되면 기존 그리드를 비웁니다.
+ *          대기 목록에 없는 상관 ID는 시간 초과로 포기한 요청의 늦은 응답이므로 버리고,
+ *          상관 ID를 보내지 않는 구버전 서버면 가장 오래된 대기 요청으로 봅니다.
+ */
+void MainWindow::onImageStreamStarted(quint32 seq)
+{
+    m_imageStreamTarget = ImagePageTarget::Discard;
+    if (seq == 0) {
+        if (!m_imagePageRequests.isEmpty()) {
+            m_imageStreamTarget = m_imagePageRequests.first().target;
+        }
+    } else {
+        for (const ImagePageRequest &request : m_imagePageRequests) {
+            if (request.seq == seq) {
+                m_imageStreamTarget = request.target;
+                break;
+            }
+        }
+    }
+    if (m_imageStreamTarget == ImagePageTarget::Replace) {
+        clearImageGrid();
+    }
+}
+
+/**
+ * @brief 이미지 한 장 수신 슬롯
+ * @param image 이미지 데이터
+ * @details 응답 전체를 기다리지 않고 디코딩된 이미지부터 바로 표시하며, 미리 받는 페이지는
+ *          스크롤이 끝에 닿을 때까지 보관합니다.
+ */
+void MainWindow::onImageReceived(const ImageData &image)
+{
+    switch (m_imageStreamTarget) {
+    case ImagePageTarget::Replace:
+        break;
+    case ImagePageTarget::Prefetch:
+        if (!m_prefetchVisible) {
+            m_prefetchedImages.append(image);
+            return;
+        }
+        break;
+    case ImagePageTarget::Discard:
+        return;
+    }
+
+    addImageToGrid(image);
+    m_imageGridWidget->adjustSize();
+}
+
 /**
  * @brief 이미지 클릭 슬롯
  * @param imagePath 이미지 경로
  * @param timestamp 타임스탬프
  * @param logText 로그 텍스트
- * @details 이미지 뷰어 다이얼로그를 실행합니다.
+ * @param imageId 원본 이미지 ID (비어 있으면 imagePath가 원본)
+ * @details 이미지 뷰어 다이얼로그를 실행합니다. 원본이 캐시에 없으면 썸네일을 먼저 띄우고
+ *          원본을 요청해 도착하는 대로 교체합니다.
  */
-void MainWindow::onImageClicked(const QString &imagePath, const QString &timestamp, const QString &logText)
+void MainWindow::onImageClicked(const QString &imagePath, const QString &timestamp, const QString &logText, const QString &imageId)
 {
+    QString viewPath = imagePath;
+    const QString cachedPath = m_fullImageCache.lookup(imageId);
+    if (!cachedPath.isEmpty()) {
+        viewPath = cachedPath;
+    }
+    const bool fetchFullImage = !imageId.isEmpty() && cachedPath.isEmpty() && m_tcpCommunicator;
 
     QPixmap pixmap;
-    if (pixmap.load(imagePath)) {
+    if (pixmap.load(viewPath)) {
         m_imageViewerDialog->setImage(pixmap, timestamp, logText);
+        m_imageViewerDialog->setStatusText(fetchFullImage ? "원본 이미지 불러오는 중..." : QString());
+        m_viewerImageId = imageId;
+
+        if (fetchFullImage) {
+            m_tcpCommunicator->requestFullImage(imageId, 15000)
+                .then(this, [this, imageId, timestamp, logText](TcpResponse response) {
+                    const QByteArray imageBytes = TcpCommunicator::fullImageBytes(response);
+                    // 뷰어를 닫았더라도 받은 원본은 보관해 다음에 바로 열리도록 함
+                    m_fullImageCache.store(imageId, imageBytes);
+
+                    if (m_viewerImageId != imageId) {
+                        return;
+                    }
+
+                    QPixmap fullPixmap;
+                    if (!imageBytes.isEmpty() && fullPixmap.loadFromData(imageBytes)) {
+                        m_imageViewerDialog->setImage(fullPixmap, timestamp, logText);
+                        m_imageViewerDialog->setStatusText(QString());
+                    } else {
+                        qDebug() << "원본 이미지 수신 실패 - image_id:" << imageId
+                                 << (response.timedOut ? "응답 시간 초과" : response.error);
+                        m_imageViewerDialog->setStatusText("원본을 불러오지 못해 썸네일을 표시합니다.");
+                    }
+                });
+        }
+
         m_imageViewerDialog->exec();
+        m_viewerImageId.clear();
     } else {
         CustomMessageBox msgBox(nullptr, "이미지 로드 오류", "이미지를 불러올 수 없습니다.");
 
@@ -845,13 +1325,13 @@ void MainWindow::onImageClicked(const QString &imagePath, const QString &timesta
  */
 void MainWindow::onRequestTimeout()
 {
-    qDebug() << "이미지 요청 타임아웃 (60초)";
+    qDebug() << "이미지 요청 타임아웃 (30초)";
 
 
     m_requestButton->setEnabled(m_isConnected);
 
     CustomMessageBox msgBox(nullptr, "요청 타임아웃",
-                            "서버에서 60초 내에 응답이 없습니다.\n"
+                            "서버에서 30초 내에 응답이 없습니다.\n"
                             "서버 상태와 네트워크 연결을 확인하고 다시 시도해주세요.");
 
     msgBox.exec();
@@ -891,6 +1371,31 @@ void MainWindow::onCoordinatesConfirmed(bool success, const QString &message)
     }
 }
 
+/**
+ * @brief 선 일괄 교체 결과 슬롯
+ * @param success 성공 여부
+ * @param message 메시지
+ * @param roadLinesProcessed 저장된 도로선 개수
+ * @param detectionLinesProcessed 저장된 감지선 개수
+ */
+void MainWindow::onCategorizedCoordinatesConfirmed(bool success, const QString &message, int roadLinesProcessed, int detectionLinesProcessed)
+{
+    qDebug() << "선 일괄 교체 확인 - 성공:" << success << "도로선:" << roadLinesProcessed
+             << "감지선:" << detectionLinesProcessed << "메시지:" << message;
+
+    if (success) {
+        CustomMessageBox msgBox(nullptr, "전송 완료",
+                                QString("좌표가 성공적으로 전송되었습니다.\n(도로선 %1개, 감지선 %2개)")
+                                    .arg(roadLinesProcessed).arg(detectionLinesProcessed));
+
+        msgBox.exec();
+    } else {
+        CustomMessageBox msgBox(nullptr, "전송 실패", "좌표 전송에 실패했습니다: " + message);
+
+        msgBox.exec();
+    }
+}
+
 /**
  * @brief 상태 업데이트 슬롯
  * @param status 상태 메시지
@@ -902,6 +1407,113 @@ void MainWindow::onStatusUpdated(const QString &status)
 
 }
 
+/**
+ * @brief 하트비트 RTT 통계 갱신 슬롯
+ * @param stats RTT 통계
+ */
+void MainWindow::onRttUpdated(const RttStats &stats)
+{
+    if (!m_linkStatsLabel) {
+        return;
+    }
+
+    // p99 기준으로 연결 품질 색상 표시
+    QString color = "#28a745";
+    if (stats.p99Ms > 500 || stats.missedPongs > 0) {
+        color = "#dc3545";
+    } else if (stats.p99Ms > 150) {
+        color = "#ffc107";
+    }
+
+    m_linkStatsLabel->setText(QString("RTT %1ms (p50 %2 / p99 %3)")
+                                  .arg(stats.lastMs).arg(stats.p50Ms).arg(stats.p99Ms));
+    m_linkStatsLabel->setStyleSheet(QString("color: %1; font-size: 11px; padding: 0px 10px;").arg(color));
+
+    QStringList lines;
+    lines << QString("샘플 %1개, p90 %2ms, 최대 %3ms, 퐁 미수신 %4회")
+                 .arg(stats.samples).arg(stats.p90Ms).arg(stats.maxMs).arg(stats.missedPongs);
+    int lower = 0;
+    for (int i = 0; i < stats.histogram.size(); ++i) {
+        const QString range = i < static_cast<int>(std::size(RttHistogramBoundsMs))
+                                  ? QString("%1~%2ms").arg(lower).arg(RttHistogramBoundsMs[i])
+                                  : QString("%1ms 초과").arg(lower);
+        lines << QString("%1: %2").arg(range, -12).arg(stats.histogram.at(i));
+        if (i < static_cast<int>(std::size(RttHistogramBoundsMs))) {
+            lower = RttHistogramBoundsMs[i];
+        }
+    }
+    m_linkStatsLabel->setToolTip(lines.join('\n'));
+}
+
+/**
+ * @brief 전체 사이트 연결 상태 변경 슬롯
+ * @param connectedSites 연결된 사이트 수
+ * @param totalSites 전체 사이트 수
+ * @details 다중 사이트 구성이거나 인증에 실패한 사이트가 있을 때 연결된 사이트 수를 표시하고,
+ *          툴팁에 사이트별 상태를 보여 줍니다.
+ */
+void MainWindow::onSiteHealthChanged(int connectedSites, int totalSites)
+{
+    if (!m_siteHealthLabel || !m_connectionManager) {
+        return;
+    }
+    const QString cameraSiteId = m_connectionManager->siteForCamera(m_cameraId);
+    QStringList lines;
+    int authFailures = 0;
+    for (const SiteHealth &health : m_connectionManager->health()) {
+        QString state;
+        switch (health.state) {
+        case ConnectionState::Disconnected: state = "연결 없음"; break;
+        case ConnectionState::Connecting: state = "연결 중"; break;
+        case ConnectionState::Handshaking: state = "핸드셰이크 중"; break;
+        case ConnectionState::Connected:
+            if (health.authenticated) {
+                state = "연결됨";
+            } else if (!health.authError.isEmpty()) {
+                state = QString("인증 실패 (%1)").arg(health.authError);
+                authFailures++;
+            } else {
+                state = "연결됨 (인증 전)";
+            }
+            break;
+        case ConnectionState::BackingOff: state = "재연결 대기"; break;
+        }
+        lines << QString("%1%2: %3 %4").arg(health.siteId, health.siteId == cameraSiteId ? " (이 카메라)" : "",
+                                            state, health.detail);
+    }
+
+    // 단일 사이트 구성에서도 인증 실패는 표시 (자세한 사유는 툴팁)
+    m_siteHealthLabel->setVisible(totalSites > 1 || authFailures > 0);
+
+    QString color = "#28a745";
+    if (connectedSites == 0 || authFailures > 0) {
+        color = "#dc3545";
+    } else if (connectedSites < totalSites) {
+        color = "#ffc107";
+    }
+    QString text = QString("사이트 %1/%2").arg(connectedSites).arg(totalSites);
+    if (authFailures > 0) {
+        text += QString(" · 인증 실패 %1").arg(authFailures);
+    }
+    m_siteHealthLabel->setText(text);
+    m_siteHealthLabel->setStyleSheet(QString("color: %1; font-size: 11px; padding: 0px 10px;").arg(color));
+    m_siteHealthLabel->setToolTip(lines.join('\n'));
+}
+
+/**
+ * @brief 사이트 인증 실패 슬롯
+ * @param siteId 사이트 ID
+ * @param reason 실패 사유
+ * @details 재연결마다 반복될 수 있으므로 모달 창 없이 상태 표시(사이트 라벨과 툴팁)만 갱신합니다.
+ */
+void MainWindow::onSiteAuthenticationFailed(const QString &siteId, const QString &reason)
+{
+    qDebug() << "[MainWindow] 사이트" << siteId << "인증 실패:" << reason;
+
+    // 네트워크가 잠깐 끊길 때마다 모달 창이 뜨지 않도록 상태 표시로만 알림
+    onSiteHealthChanged(m_connectionManager->connectedSiteCount(), m_connectionManager->siteIds().size());
+}
+
 /**
  * @brief 좌표 데이터 전송
  * @param roadLines 도로선 리스트
@@ -911,23 +1523,18 @@ void MainWindow::onStatusUpdated(const QString &status)
 void MainWindow::sendCategorizedCoordinates(const QList<RoadLineData> &roadLines, const QList<DetectionLineData> &detectionLines)
 {
     if (m_tcpCommunicator && m_tcpCommunicator->isConnectedToServer()) {
-        // 새로운 RoadLineData 구조를 직접 사용
-        if (!roadLines.isEmpty()) {
-            bool roadSuccess = m_tcpCommunicator->sendMultipleRoadLines(roadLines);
-            if (roadSuccess) {
-                qDebug() << "도로선 전송 완료:" << roadLines.size() << "개";
-            }
+        // 도로선/감지선을 한 프레임으로 일괄 교체 (구버전 서버는 선별 전송으로 대체)
+        if (m_tcpCommunicator->sendLineSet(roadLines, detectionLines)) {
+            qDebug() << "카테고리별 좌표 전송 요청 - 도로선:" << roadLines.size() << "개, 감지선:" << detectionLines.size() << "개";
         }
+    } else if (m_tcpCommunicator && m_tcpCommunicator->isOfflineOutboxEnabled()) {
+        // 연결이 없으면 송신함에 보관했다가 재연결 시 전송 (이전에 보관된 선 편집은 이 요청으로 대체)
+        if (m_tcpCommunicator->sendLineSet(roadLines, detectionLines)) {
+            qDebug() << "카테고리별 좌표 오프라인 보관 - 도로선:" << roadLines.size() << "개, 감지선:" << detectionLines.size() << "개";
+            CustomMessageBox msgBox(nullptr, "오프라인 저장", "서버에 연결되어 있지 않아 변경 사항을 보관했습니다.\n재연결되면 자동으로 전송합니다.");
 
-        // 감지선 전송 (기존 방식 유지)
-        if (!detectionLines.isEmpty()) {
-            bool detectionSuccess = m_tcpCommunicator->sendMultipleDetectionLines(detectionLines);
-            if (detectionSuccess) {
-                qDebug() << "감지선 전송 완료:" << detectionLines.size() << "개";
-            }
+            msgBox.exec();
         }
-
-        qDebug() << "카테고리별 좌표 전송 완료 - 도로선:" << roadLines.size() << "개, 감지선:" << detectionLines.size() << "개";
     } else {
         qDebug() << "TCP 연결이 없어 좌표 전송 실패";
         CustomMessageBox msgBox(nullptr, "전송 실패", "서버에 연결되어 있지 않습니다.");
@@ -5,6 +5,8 @@
 #include "TcpCommunicator.h"
 #include "ImageViewerDialog.h"
 #include "LineDrawingDialog.h"
+#include "ImageCache.h"
+#include "ConnectionManager.h"
 
 #include <QMainWindow>
 #include <QTabWidget>
@@ -47,9 +49,11 @@ public:
      * @param imagePath 이미지 경로
      * @param timestamp 타임스탬프
      * @param logText 로그 텍스트
+     * @param imageId 원본 이미지 ID (비어 있으면 imagePath가 원본)
      * @details 이미지와 관련된 데이터를 설정합니다.
      */
-    void setImageData(const QString &imagePath, const QString &timestamp, const QString &logText);
+    void setImageData(const QString &imagePath, const QString &timestamp, const QString &logText,
+                      const QString &imageId = QString());
 
 signals:
     /**
@@ -57,8 +61,9 @@ signals:
      * @param imagePath 이미지 경로
      * @param timestamp 타임스탬프
      * @param logText 로그 텍스트
+     * @param imageId 원본 이미지 ID
      */
-    void clicked(const QString &imagePath, const QString &timestamp, const QString &logText);
+    void clicked(const QString &imagePath, const QString &timestamp, const QString &logText, const QString &imageId);
 
 
 private:
@@ -68,6 +73,8 @@ private:
     QString m_timestamp;
     /** @brief 로그 텍스트 */
     QString m_logText;
+    /** @brief 원본 이미지 ID */
+    QString m_imageId;
 
 protected:
     /**
@@ -104,6 +111,12 @@ public:
      * @param communicator TCP 통신 객체
      */
     void setTcpCommunicator(TcpCommunicator* communicator);
+    /**
+     * @brief 다중 사이트 연결 관리자 설정
+     * @details 이 창의 카메라(CAMERA_ID)가 속한 사이트 통신기로 요청을 보내고, 전체 사이트 연결 상태를 표시합니다.
+     * @param manager 연결 관리자
+     */
+    void setConnectionManager(ConnectionManager *manager);
 
 private slots:
     /**
@@ -169,17 +182,48 @@ private slots:
      * @param images 이미지 리스트
      */
     void onImagesReceived(const QList<ImageData> &images);
+    /**
+     * @brief 이미지 응답 수신 시작 슬롯
+     * @param seq 응답의 상관 ID (모르면 0)
+     */
+    void onImageStreamStarted(quint32 seq);
+    /**
+     * @brief 이미지 한 장 수신 슬롯
+     * @param image 이미지 데이터
+     */
+    void onImageReceived(const ImageData &image);
     /**
      * @brief 이미지 클릭 시 슬롯
      * @param imagePath 이미지 경로
      * @param timestamp 타임스탬프
      * @param logText 로그 텍스트
+     * @param imageId 원본 이미지 ID (비어 있으면 imagePath가 원본)
      */
-    void onImageClicked(const QString &imagePath, const QString &timestamp, const QString &logText);
+    void onImageClicked(const QString &imagePath, const QString &timestamp, const QString &logText, const QString &imageId);
     /**
      * @brief 요청 타임아웃 시 슬롯
      */
     void onRequestTimeout();
+    /**
+     * @brief 이미지 스크롤 위치/범위 변경 슬롯
+     */
+    void onImageScrolled();
+    /**
+     * @brief 실시간 캡처 버튼 토글 슬롯
+     * @param checked 실시간 모드 여부
+     */
+    void onLiveToggled(bool checked);
+    /**
+     * @brief 실시간 캡처 수신 슬롯
+     * @param image 캡처 이미지 데이터 (썸네일)
+     */
+    void onLiveCaptureReceived(const ImageData &image);
+    /**
+     * @brief 실시간 캡처 구독 상태 변경 슬롯
+     * @param active 서버가 구독을 받았는지 여부
+     * @param message 상태 메시지
+     */
+    void onCaptureSubscriptionChanged(bool active, const QString &message);
     /**
      * @brief 스트림 에러 발생 시 슬롯
      * @param error 에러 메시지
@@ -191,11 +235,36 @@ private slots:
      * @param message 메시지
      */
     void onCoordinatesConfirmed(bool success, const QString &message);
+    /**
+     * @brief 선 일괄 교체 결과 슬롯
+     * @param success 성공 여부
+     * @param message 메시지
+     * @param roadLinesProcessed 저장된 도로선 개수
+     * @param detectionLinesProcessed 저장된 감지선 개수
+     */
+    void onCategorizedCoordinatesConfirmed(bool success, const QString &message, int roadLinesProcessed, int detectionLinesProcessed);
     /**
      * @brief 상태 업데이트 슬롯
      * @param status 상태 메시지
      */
     void onStatusUpdated(const QString &status);
+    /**
+     * @brief 하트비트 RTT 통계 갱신 슬롯
+     * @param stats RTT 통계
+     */
+    void onRttUpdated(const RttStats &stats);
+    /**
+     * @brief 전체 사이트 연결 상태 변경 슬롯
+     * @param connectedSites 연결된 사이트 수
+     * @param totalSites 전체 사이트 수
+     */
+    void onSiteHealthChanged(int connectedSites, int totalSites);
+    /**
+     * @brief 사이트 인증 실패 슬롯
+     * @param siteId 사이트 ID
+     * @param reason 실패 사유
+     */
+    void onSiteAuthenticationFailed(const QString &siteId, const QString &reason);
 
 private:
     /**
@@ -241,6 +310,39 @@ private:
      * @param images 이미지 리스트
      */
     void displayImages(const QList<ImageData> &images);
+    /**
+     * @brief 이미지 한 장을 그리드 끝에 추가
+     * @param imageData 이미지 데이터
+     */
+    void addImageToGrid(const ImageData &imageData);
+    /**
+     * @brief 캡처 이미지 라벨 생성 (그리드/실시간 타임라인 공용)
+     * @param imageData 이미지 데이터
+     * @param size 라벨 크기
+     * @return 클릭하면 뷰어를 여는 이미지 라벨
+     */
+    ClickableImageLabel *createImageLabel(const ImageData &imageData, const QSize &size);
+    /**
+     * @brief 이미지 페이지 요청 완료 처리
+     * @param seq 요청의 상관 ID
+     * @param response 요청 결과
+     */
+    void onImagePageFinished(quint32 seq, const TcpResponse &response);
+    /**
+     * @brief 다음 이미지 페이지 요청
+     * @param showOnArrival 받는 즉시 그리드에 표시할지 여부 (false면 미리 받아 보관)
+     */
+    void requestNextImagePage(bool showOnArrival);
+    /**
+     * @brief 응답 대기 중인 이미지 페이지 요청이 있는지 여부
+     * @return 있으면 true
+     */
+    bool isImagePageInFlight() const;
+    /**
+     * @brief 이미지 스크롤이 끝 부근인지 여부
+     * @return 마지막 줄 근처이거나 스크롤할 내용이 없으면 true
+     */
+    bool isImageScrollNearEnd() const;
     /**
      * @brief 좌표 데이터 전송
      * @param roadLines 도로선 리스트
@@ -259,6 +361,10 @@ private:
     QWidget *m_centralWidget;
     /** @brief 탭 위젯 */
     QTabWidget *m_tabWidget;
+    /** @brief 연결 품질(RTT) 표시 라벨 */
+    QLabel *m_linkStatsLabel;
+    /** @brief 사이트 연결 상태 표시 라벨 (다중 사이트일 때만 표시) */
+    QLabel *m_siteHealthLabel;
 
 
     // Live Video Tab
@@ -278,6 +384,54 @@ private:
     QWidget *m_imageGridWidget;
     /** @brief 이미지 그리드 레이아웃 */
     QGridLayout *m_imageGridLayout;
+    /** @brief 그리드에 표시된 이미지 개수 */
+    int m_imageGridCount;
+
+    /**
+     * @brief 이미지 페이지 응답 표시 대상
+     */
+    enum class ImagePageTarget {
+        Replace,    // 첫 페이지 - 그리드를 비우고 표시
+        Prefetch,   // 다음 페이지 - 스크롤이 끝에 닿을 때까지 보관
+        Discard     // 새 조회로 대체된 요청 - 무시
+    };
+    /**
+     * @brief 응답 대기 중인 페이지 요청
+     */
+    struct ImagePageRequest {
+        quint32 seq;                // 요청의 상관 ID (응답과 매칭)
+        ImagePageTarget target;     // 표시 대상
+    };
+    /** @brief 응답 대기 중인 페이지 요청 (요청 순서) */
+    QList<ImagePageRequest> m_imagePageRequests;
+    /** @brief 수신 중인 응답의 표시 대상 */
+    ImagePageTarget m_imageStreamTarget;
+    /** @brief 조회 중인 날짜 ("yyyy-MM-dd") */
+    QString m_imageQueryDate;
+    /** @brief 조회 중인 시간 (음수면 하루 전체) */
+    int m_imageQueryHour;
+    /** @brief 페이지 크기 (IMAGE_PAGE_SIZE) */
+    int m_imagePageSize;
+    /** @brief 다음 페이지 커서 (비어 있으면 마지막 페이지까지 받음) */
+    QString m_imageNextCursor;
+    /** @brief 조회 조건의 전체 이미지 수 힌트 (모르면 -1) */
+    int m_imageTotalCount;
+    /** @brief 미리 받아 아직 표시하지 않은 이미지 */
+    QList<ImageData> m_prefetchedImages;
+    /** @brief 진행 중인 다음 페이지를 도착 즉시 표시할지 여부 */
+    bool m_prefetchVisible;
+    /** @brief 실시간 캡처 버튼 */
+    QPushButton *m_liveButton;
+    /** @brief 실시간 캡처 구독 상태 라벨 */
+    QLabel *m_liveStatusLabel;
+    /** @brief 실시간 캡처 타임라인 스크롤 영역 */
+    QScrollArea *m_liveTimelineArea;
+    /** @brief 실시간 캡처 타임라인 레이아웃 (최신이 왼쪽) */
+    QHBoxLayout *m_liveTimelineLayout;
+    /** @brief 타임라인에 표시된 캡처 수 */
+    int m_liveTimelineCount;
+    /** @brief 타임라인 최대 캡처 수 (LIVE_TIMELINE_MAX) */
+    int m_liveTimelineMax;
     /** @brief 날짜 버튼 */
     QPushButton *m_dateButton;
     /** @brief 시간 콤보박스 */
@@ -308,17 +462,23 @@ private:
     bool m_isConnected;
 
     // 네트워크 관련
-    /** @brief TCP 통신 객체 */
+    /** @brief 이 창의 카메라 ID (CAMERA_ID, 비어 있으면 기본 사이트) */
+    QString m_cameraId;
+    /** @brief 다중 사이트 연결 관리자 */
+    ConnectionManager *m_connectionManager;
+    /** @brief TCP 통신 객체 (카메라가 속한 사이트) */
     TcpCommunicator *m_tcpCommunicator;
     /** @brief 네트워크 매니저 */
     QNetworkAccessManager *m_networkManager;
     /** @brief 업데이트 타이머 */
     QTimer *m_updateTimer;
-    /** @brief 이미지 요청 타임아웃 타이머 */
-    QTimer *m_requestTimeoutTimer;
 
     /** @brief 이미지 뷰어 다이얼로그 */
     ImageViewerDialog *m_imageViewerDialog;
+    /** @brief 뷰어에 표시 중인 원본 이미지 ID (원본 수신 후 교체 대상 확인용) */
+    QString m_viewerImageId;
+    /** @brief 원본 이미지 디스크 캐시 */
+    ImageCache m_fullImageCache;
     /** @brief 라인 드로잉 다이얼로그 */
     LineDrawingDialog *m_lineDrawingDialog;
 
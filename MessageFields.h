@@ -0,0 +1,257 @@
+#ifndef MESSAGEFIELDS_H
+#define MESSAGEFIELDS_H
+
+#include <QCborMap>
+#include <QCborValue>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QRect>
+#include <QString>
+
+#include <tuple>
+#include <utility>
+
+#include "ObjectClass.h"
+
+/**
+ * @brief 메시지 필드 설명 특성
+ * @details 구조체마다 특수화해 `fields` 튜플에 서버 양식 순서대로 필드를 나열하면,
+ *          아래 decode/encode 템플릿이 JSON/CBOR 양쪽 변환 코드를 만들어 냅니다.
+ * @code
+ * template <> struct MessageFields<RoadLineData> {
+ *     static constexpr auto fields = std::make_tuple(
+ *         messageField("index", &RoadLineData::index),
+ *         messageField("x1", &RoadLineData::x1));
+ * };
+ * @endcode
+ */
+template <typename T>
+struct MessageFields;
+
+/**
+ * @brief 멤버 하나에 대응하는 필드
+ */
+template <typename T, typename M>
+struct MessageField {
+    QLatin1String name;     // 서버 양식 키
+    M T::*member;           // 대상 멤버
+};
+
+/**
+ * @brief QRect 멤버의 한 성분에 대응하는 필드 (BBox의 x/y/width/height 등)
+ */
+template <typename T>
+struct MessageRectField {
+    /**
+     * @brief QRect 성분
+     */
+    enum Part {
+        X,
+        Y,
+        Width,
+        Height
+    };
+
+    QLatin1String name;     // 서버 양식 키
+    QRect T::*member;       // 대상 QRect 멤버
+    Part part;              // 성분
+};
+
+/**
+ * @brief 멤버 필드 설명 생성
+ * @param name 서버 양식 키
+ * @param member 대상 멤버
+ * @return 필드 설명
+ */
+template <typename T, typename M, qsizetype N>
+constexpr MessageField<T, M> messageField(const char (&name)[N], M T::*member)
+{
+    return MessageField<T, M>{QLatin1String(name, N - 1), member};
+}
+
+/**
+ * @brief QRect 성분 필드 설명 생성
+ * @param name 서버 양식 키
+ * @param member 대상 QRect 멤버
+ * @param part 성분
+ * @return 필드 설명
+ */
+template <typename T, qsizetype N>
+constexpr MessageRectField<T> messageRectField(const char (&name)[N], QRect T::*member,
+                                               typename MessageRectField<T>::Part part)
+{
+    return MessageRectField<T>{QLatin1String(name, N - 1), member, part};
+}
+
+/**
+ * @brief JSON 값 변환
+ * @details 값 참조(QJsonValueConstRef)를 그대로 받아 임시 QJsonValue를 만들지 않습니다.
+ */
+struct JsonFieldAccess {
+    using Object = QJsonObject;
+
+    template <typename V> static void read(const V &value, int &out) { out = value.toInt(); }
+    template <typename V> static void read(const V &value, qint64 &out) { out = value.toInteger(); }
+    template <typename V> static void read(const V &value, double &out) { out = value.toDouble(); }
+    template <typename V> static void read(const V &value, QString &out) { out = value.toString(); }
+    template <typename V> static void read(const V &value, ObjectClass &out) { out = ObjectClassTable::intern(value.toString()); }
+
+    static QJsonValue write(int value) { return QJsonValue(value); }
+    static QJsonValue write(qint64 value) { return QJsonValue(value); }
+    static QJsonValue write(double value) { return QJsonValue(value); }
+    static QJsonValue write(const QString &value) { return QJsonValue(value); }
+    static QJsonValue write(ObjectClass value) { return QJsonValue(ObjectClassTable::name(value)); }
+};
+
+/**
+ * @brief CBOR 값 변환
+ */
+struct CborFieldAccess {
+    using Object = QCborMap;
+
+    template <typename V> static void read(const V &value, int &out) { out = static_cast<int>(value.toInteger()); }
+    template <typename V> static void read(const V &value, qint64 &out) { out = value.toInteger(); }
+    template <typename V> static void read(const V &value, double &out) { out = value.toDouble(); }
+    template <typename V> static void read(const V &value, QString &out) { out = value.toString(); }
+    template <typename V> static void read(const V &value, ObjectClass &out) { out = ObjectClassTable::intern(value.toString()); }
+
+    static QCborValue write(int value) { return QCborValue(value); }
+    static QCborValue write(qint64 value) { return QCborValue(value); }
+    static QCborValue write(double value) { return QCborValue(value); }
+    static QCborValue write(const QString &value) { return QCborValue(value); }
+    static QCborValue write(ObjectClass value) { return QCborValue(ObjectClassTable::name(value)); }
+};
+
+/**
+ * @brief 멤버 필드 하나 읽기 (키가 없으면 기존 값 유지)
+ */
+template <typename Access, typename T, typename M>
+void decodeMessageField(const typename Access::Object &object, T &out, const MessageField<T, M> &field)
+{
+    const auto it = object.constFind(field.name);
+    if (it != object.constEnd()) {
+        Access::read(it.value(), out.*field.member);
+    }
+}
+
+/**
+ * @brief QRect 성분 필드 하나 읽기 (키가 없으면 기존 값 유지)
+ */
+template <typename Access, typename T>
+void decodeMessageField(const typename Access::Object &object, T &out, const MessageRectField<T> &field)
+{
+    const auto it = object.constFind(field.name);
+    if (it == object.constEnd()) {
+        return;
+    }
+
+    int value = 0;
+    Access::read(it.value(), value);
+    QRect &rect = out.*field.member;
+    switch (field.part) {
+    case MessageRectField<T>::X:
+        rect.moveLeft(value);
+        break;
+    case MessageRectField<T>::Y:
+        rect.moveTop(value);
+        break;
+    case MessageRectField<T>::Width:
+        rect.setWidth(value);
+        break;
+    case MessageRectField<T>::Height:
+        rect.setHeight(value);
+        break;
+    }
+}
+
+/**
+ * @brief 멤버 필드 하나 쓰기
+ */
+template <typename Access, typename T, typename M>
+void encodeMessageField(typename Access::Object &object, const T &in, const MessageField<T, M> &field)
+{
+    object.insert(field.name, Access::write(in.*field.member));
+}
+
+/**
+ * @brief QRect 성분 필드 하나 쓰기
+ */
+template <typename Access, typename T>
+void encodeMessageField(typename Access::Object &object, const T &in, const MessageRectField<T> &field)
+{
+    const QRect &rect = in.*field.member;
+    int value = 0;
+    switch (field.part) {
+    case MessageRectField<T>::X:
+        value = rect.x();
+        break;
+    case MessageRectField<T>::Y:
+        value = rect.y();
+        break;
+    case MessageRectField<T>::Width:
+        value = rect.width();
+        break;
+    case MessageRectField<T>::Height:
+        value = rect.height();
+        break;
+    }
+    object.insert(field.name, Access::write(value));
+}
+
+/**
+ * @brief JSON 객체를 구조체로 변환
+ * @param object JSON 객체
+ * @param out 기본값이 채워진 구조체 (없는 키는 이 값 유지)
+ * @return 변환된 구조체
+ */
+template <typename T>
+T decodeJsonFields(const QJsonObject &object, T out = T())
+{
+    std::apply([&](const auto &...fields) { (decodeMessageField<JsonFieldAccess>(object, out, fields), ...); },
+               MessageFields<T>::fields);
+    return out;
+}
+
+/**
+ * @brief CBOR 맵을 구조체로 변환
+ * @param map CBOR 맵
+ * @param out 기본값이 채워진 구조체 (없는 키는 이 값 유지)
+ * @return 변환된 구조체
+ */
+template <typename T>
+T decodeCborFields(const QCborMap &map, T out = T())
+{
+    std::apply([&](const auto &...fields) { (decodeMessageField<CborFieldAccess>(map, out, fields), ...); },
+               MessageFields<T>::fields);
+    return out;
+}
+
+/**
+ * @brief 구조체를 JSON 객체로 변환
+ * @param in 구조체
+ * @return JSON 객체
+ */
+template <typename T>
+QJsonObject encodeJsonFields(const T &in)
+{
+    QJsonObject object;
+    std::apply([&](const auto &...fields) { (encodeMessageField<JsonFieldAccess>(object, in, fields), ...); },
+               MessageFields<T>::fields);
+    return object;
+}
+
+/**
+ * @brief 구조체를 CBOR 맵으로 변환
+ * @param in 구조체
+ * @return CBOR 맵 (필드 설명 순서 유지)
+ */
+template <typename T>
+QCborMap encodeCborFields(const T &in)
+{
+    QCborMap map;
+    std::apply([&](const auto &...fields) { (encodeMessageField<CborFieldAccess>(map, in, fields), ...); },
+               MessageFields<T>::fields);
+    return map;
+}
+
+#endif // MESSAGEFIELDS_H
@@ -0,0 +1,121 @@
+#include "ObjectClass.h"
+
+#include <QDebug>
+
+/**
+ * @brief ObjectClassTable 생성자
+ * @details 미리 정한 클래스를 enum 순서대로 등록합니다.
+ */
+ObjectClassTable::ObjectClassTable()
+    : m_overflowLogged(false)
+{
+    m_names << QString() << "Vehicle" << "Person" << "Human";
+    for (int i = 1; i < m_names.size(); ++i) {
+        const ObjectClass objectClass = static_cast<ObjectClass>(i);
+        m_byName.insert(m_names.at(i), objectClass);
+        m_byLowerName.insert(m_names.at(i).toLower(), objectClass);
+    }
+    // 서버 구버전의 오타 표기
+    m_byLowerName.insert("vehical", ObjectClass::Vehicle);
+}
+
+/**
+ * @brief 공유 인스턴스
+ * @return 인스턴스
+ */
+ObjectClassTable &ObjectClassTable::instance()
+{
+    static ObjectClassTable table;
+    return table;
+}
+
+/**
+ * @brief 이름으로 원자 찾기 (없으면 등록)
+ * @details BBox마다 불리므로 먼저 스레드별 캐시에서 잠금 없이 찾습니다.
+ * @param name 서버가 보낸 클래스 이름
+ * @return 원자 (빈 이름이거나 클래스 상한을 넘은 새 이름이면 Unknown)
+ */
+ObjectClass ObjectClassTable::intern(const QString &name)
+{
+    if (name.isEmpty()) {
+        return ObjectClass::Unknown;
+    }
+
+    // 원자는 한 번 정해지면 바뀌지 않으므로 (상한으로 Unknown이 된 이름도 마찬가지) 그대로 재사용
+    thread_local QHash<QString, ObjectClass> localCache;
+    const auto cached = localCache.constFind(name);
+    if (cached != localCache.constEnd()) {
+        return *cached;
+    }
+
+    const ObjectClass objectClass = instance().lookupOrRegister(name);
+    if (localCache.size() >= MaxCachedSpellings) {
+        localCache.clear();
+    }
+    localCache.insert(name, objectClass);
+    return objectClass;
+}
+
+/**
+ * @brief 공유 표에서 찾기 (없으면 상한 안에서 등록)
+ * @param name 서버가 보낸 클래스 이름 (비어 있지 않음)
+ * @return 원자 (클래스 상한을 넘은 새 이름이면 Unknown)
+ */
+ObjectClass ObjectClassTable::lookupOrRegister(const QString &name)
+{
+    {
+        QReadLocker locker(&m_lock);
+        const auto it = m_byName.constFind(name);
+        if (it != m_byName.constEnd()) {
+            return *it;
+        }
+    }
+
+    // 처음 보는 표기: 대소문자만 다른 기존 클래스가 있으면 그 원자로 연결
+    QWriteLocker locker(&m_lock);
+    const QString lowerName = name.toLower();
+    ObjectClass objectClass = m_byLowerName.value(lowerName, ObjectClass::Unknown);
+    if (objectClass == ObjectClass::Unknown) {
+        if (m_names.size() >= MaxClasses) {
+            // 비정상 입력으로 표가 커지지 않도록 새 클래스는 표기도 저장하지 않음
+            if (!m_overflowLogged) {
+                qDebug() << "[BBox] 객체 클래스 상한" << MaxClasses << "도달 - 이후 새 클래스는 Unknown으로 처리:" << name;
+                m_overflowLogged = true;
+            }
+            return ObjectClass::Unknown;
+        }
+        objectClass = static_cast<ObjectClass>(m_names.size());
+        m_names.append(name);
+        m_byLowerName.insert(lowerName, objectClass);
+        qDebug() << "[BBox] 새 객체 클래스 등록:" << name << "->" << static_cast<int>(objectClass);
+    }
+
+    // 대소문자 변형은 상한까지만 보관 (넘으면 다음에도 소문자 표에서 찾음)
+    if (m_byName.size() < MaxSpellings) {
+        m_byName.insert(name, objectClass);
+    }
+    return objectClass;
+}
+
+/**
+ * @brief 원자의 표시 이름
+ * @param objectClass 원자
+ * @return 이름 (등록되지 않은 원자면 빈 문자열)
+ */
+QString ObjectClassTable::name(ObjectClass objectClass)
+{
+    ObjectClassTable &table = instance();
+    QReadLocker locker(&table.m_lock);
+    return table.m_names.value(static_cast<int>(objectClass));
+}
+
+/**
+ * @brief 등록된 클래스 수 (Unknown 포함)
+ * @return 클래스 수
+ */
+int ObjectClassTable::count()
+{
+    ObjectClassTable &table = instance();
+    QReadLocker locker(&table.m_lock);
+    return table.m_names.size();
+}
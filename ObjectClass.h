@@ -0,0 +1,79 @@
+#ifndef OBJECTCLASS_H
+#define OBJECTCLASS_H
+
+#include <QHash>
+#include <QList>
+#include <QReadWriteLock>
+#include <QString>
+
+/**
+ * @brief 객체 클래스 원자
+ * @details BBox 타입 문자열을 한 번만 정수로 바꿔 두고, 이후 필터링/비교는 정수로 합니다.
+ *          아래 값은 미리 등록된 클래스이며, 서버가 처음 보내는 클래스는 ObjectClassTable이
+ *          다음 번호를 붙여 등록합니다 (상한을 넘으면 Unknown).
+ */
+enum class ObjectClass : quint16 {
+    Unknown = 0,    // 타입 없음
+    Vehicle,        // 차량
+    Person,         // 사람
+    Human           // 사람 (서버 구버전 표기)
+};
+
+/**
+ * @brief 객체 클래스 이름 ↔ 원자 변환 표
+ * @details 프로세스 전체에서 하나를 공유하며, 네트워크 스레드의 디코더가 등록하고 GUI 스레드가
+ *          이름을 조회하므로 읽기/쓰기 잠금으로 보호합니다. 이름은 대소문자를 구분하지 않고 같은
+ *          클래스로 보며, 처음 받은 표기를 표시 이름으로 씁니다.
+ *          등록된 원자는 바뀌거나 지워지지 않으므로 intern()은 스레드별 캐시에서 잠금 없이 찾고,
+ *          캐시에 없을 때만 공유 표를 봅니다. 비정상 입력으로 표가 계속 커지지 않도록 클래스 수와
+ *          보관하는 표기 변형 수에 상한을 두며, 상한을 넘은 새 클래스는 표기를 저장하지 않고
+ *          Unknown으로 봅니다.
+ */
+class ObjectClassTable
+{
+public:
+    /**
+     * @brief 이름으로 원자 찾기 (없으면 등록)
+     * @param name 서버가 보낸 클래스 이름
+     * @return 원자 (빈 이름이면 Unknown)
+     */
+    static ObjectClass intern(const QString &name);
+    /**
+     * @brief 원자의 표시 이름
+     * @param objectClass 원자
+     * @return 이름 (등록되지 않은 원자면 빈 문자열)
+     */
+    static QString name(ObjectClass objectClass);
+    /**
+     * @brief 등록된 클래스 수 (Unknown 포함)
+     * @return 클래스 수
+     */
+    static int count();
+
+private:
+    ObjectClassTable();
+    /** @brief 공유 인스턴스 */
+    static ObjectClassTable &instance();
+    /** @brief 공유 표에서 찾기 (없으면 상한 안에서 등록) */
+    ObjectClass lookupOrRegister(const QString &name);
+
+    /** @brief 원자 수 상한 (Unknown과 미리 등록된 클래스 포함) */
+    static constexpr int MaxClasses = 256;
+    /** @brief 받은 표기 그대로 보관하는 수 상한 (넘으면 소문자 표로만 찾음) */
+    static constexpr int MaxSpellings = 1024;
+    /** @brief 스레드별 캐시 크기 상한 (넘으면 비움) */
+    static constexpr int MaxCachedSpellings = 64;
+
+    /** @brief 잠금 */
+    QReadWriteLock m_lock;
+    /** @brief 받은 표기 그대로 → 원자 */
+    QHash<QString, ObjectClass> m_byName;
+    /** @brief 소문자 이름 → 원자 (처음 보는 표기일 때만 조회) */
+    QHash<QString, ObjectClass> m_byLowerName;
+    /** @brief 원자 → 표시 이름 */
+    QList<QString> m_names;
+    /** @brief 클래스 상한 도달 로그 여부 (한 번만 기록) */
+    bool m_overflowLogged;
+};
+
+#endif // OBJECTCLASS_H
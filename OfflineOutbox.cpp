@@ -0,0 +1,269 @@
+#include "OfflineOutbox.h"
+
+#include <QDebug>
+#include <QDir>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QSaveFile>
+#include <QUuid>
+
+namespace {
+// 파일 첫 줄 (형식 버전)
+constexpr int OutboxFormatVersion = 1;
+// 죽은 레코드가 이 수 이상이고 남은 항목보다 많으면 파일 압축
+constexpr int CompactThresholdRecords = 64;
+}
+
+/**
+ * @brief OfflineOutbox 생성자
+ */
+OfflineOutbox::OfflineOutbox()
+    : m_deadRecords(0)
+    , m_superseded(0)
+{
+}
+
+/**
+ * @brief 송신함 파일 열기
+ * @param filePath 파일 경로 (빈 문자열이면 닫기)
+ * @return 성공 여부
+ */
+bool OfflineOutbox::open(const QString &filePath)
+{
+    close();
+    if (filePath.isEmpty()) {
+        return true;
+    }
+
+    QFile file(filePath);
+    if (file.open(QIODevice::ReadOnly)) {
+        bool headerChecked = false;
+        int lineNumber = 0;
+        while (!file.atEnd()) {
+            const QByteArray line = file.readLine().trimmed();
+            lineNumber++;
+            if (line.isEmpty()) {
+                continue;
+            }
+
+            QJsonParseError parseError;
+            const QJsonObject record = QJsonDocument::fromJson(line, &parseError).object();
+            if (parseError.error != QJsonParseError::NoError) {
+                // 기록 중 종료되어 잘린 마지막 줄
+                qDebug() << "[TCP] 오프라인 송신함 손상된 레코드 무시 - 줄" << lineNumber;
+                continue;
+            }
+
+            if (!headerChecked) {
+                headerChecked = true;
+                if (record["outbox"].toInt() != OutboxFormatVersion) {
+                    qDebug() << "[TCP] 오프라인 송신함 파일 형식 불일치 - 무시:" << filePath;
+                    break;
+                }
+                continue;
+            }
+
+            const QString op = record["op"].toString();
+            const QString key = record["key"].toString();
+            if (op == "add") {
+                OutboxEntry entry;
+                entry.key = key;
+                entry.group = record["group"].toString();
+                entry.replacesGroup = record["replaces"].toBool();
+                entry.message = record["message"].toObject();
+                entry.queuedAt = QDateTime::fromString(record["queued_at"].toString(), Qt::ISODateWithMs);
+                m_entries.append(entry);
+            } else if (op == "ack" || op == "drop") {
+                const int index = indexOf(key);
+                if (index >= 0) {
+                    m_entries.removeAt(index);
+                }
+            }
+        }
+        file.close();
+    }
+
+    m_file.setFileName(filePath);
+    // 복원한 항목만으로 다시 써서 지난 실행의 ack/drop 레코드를 정리하고 추가 모드로 염
+    if (!rewrite()) {
+        m_entries.clear();
+        return false;
+    }
+
+    qDebug() << "[TCP] 오프라인 송신함 열기 - 대기" << m_entries.size() << "건:" << filePath;
+    return true;
+}
+
+/**
+ * @brief 송신함 파일 닫기 (메모리 항목도 비움)
+ */
+void OfflineOutbox::close()
+{
+    if (m_file.isOpen()) {
+        m_file.close();
+    }
+    m_entries.clear();
+    m_deadRecords = 0;
+}
+
+/**
+ * @brief 요청 보관
+ * @param message 전송할 메시지
+ * @param group 압축 그룹
+ * @param replacesGroup 그룹 전체 교체 요청 여부
+ * @return 멱등 키 (기록 실패 시 빈 문자열)
+ */
+QString OfflineOutbox::append(const QJsonObject &message, const QString &group, bool replacesGroup)
+{
+    if (!m_file.isOpen()) {
+        return QString();
+    }
+
+    OutboxEntry entry;
+    entry.key = QUuid::createUuid().toString(QUuid::WithoutBraces);
+    entry.group = group;
+    entry.replacesGroup = replacesGroup;
+    entry.message = message;
+    entry.message["idempotency_key"] = entry.key;
+    entry.queuedAt = QDateTime::currentDateTimeUtc();
+
+    // 새 항목을 먼저 기록해, 중간에 종료되어도 대체 대상만 남고 새 편집이 사라지지 않도록 함
+    if (!writeRecord(entryRecord(entry))) {
+        return QString();
+    }
+
+    if (replacesGroup && !group.isEmpty()) {
+        for (int i = m_entries.size() - 1; i >= 0; --i) {
+            if (m_entries.at(i).group != group) {
+                continue;
+            }
+            QJsonObject drop;
+            drop["op"] = "drop";
+            drop["key"] = m_entries.at(i).key;
+            writeRecord(drop);
+            m_entries.removeAt(i);
+            m_deadRecords += 2;
+            m_superseded++;
+        }
+    }
+
+    m_entries.append(entry);
+    return entry.key;
+}
+
+/**
+ * @brief 전달 확인된 항목 제거
+ * @param key 멱등 키
+ * @return 항목이 있었으면 true
+ */
+bool OfflineOutbox::acknowledge(const QString &key)
+{
+    const int index = indexOf(key);
+    if (index < 0) {
+        return false;
+    }
+    m_entries.removeAt(index);
+
+    if (m_entries.isEmpty() || (m_deadRecords >= CompactThresholdRecords && m_deadRecords > m_entries.size())) {
+        // 비었거나 죽은 레코드가 많으면 ack를 남기는 대신 파일을 다시 씀
+        rewrite();
+        return true;
+    }
+
+    QJsonObject ack;
+    ack["op"] = "ack";
+    ack["key"] = key;
+    writeRecord(ack);
+    m_deadRecords += 2;
+    return true;
+}
+
+/**
+ * @brief 레코드 한 줄 추가
+ * @param record 레코드
+ * @return 성공 여부
+ */
+bool OfflineOutbox::writeRecord(const QJsonObject &record)
+{
+    QByteArray line = QJsonDocument(record).toJson(QJsonDocument::Compact);
+    line.append('\n');
+
+    if (m_file.write(line) != line.size() || !m_file.flush()) {
+        qDebug() << "[TCP] 오프라인 송신함 기록 실패:" << m_file.errorString();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief 남은 항목만으로 파일 다시 쓰기
+ * @details QSaveFile로 원자적으로 교체한 뒤 추가 모드로 다시 엽니다.
+ * @return 성공 여부
+ */
+bool OfflineOutbox::rewrite()
+{
+    const QString filePath = m_file.fileName();
+    if (m_file.isOpen()) {
+        m_file.close();
+    }
+
+    QDir().mkpath(QFileInfo(filePath).absolutePath());
+
+    QSaveFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qDebug() << "[TCP] 오프라인 송신함 저장 실패:" << file.errorString();
+        return false;
+    }
+    file.setPermissions(QFileDevice::ReadOwner | QFileDevice::WriteOwner);
+
+    QJsonObject header;
+    header["outbox"] = OutboxFormatVersion;
+    file.write(QJsonDocument(header).toJson(QJsonDocument::Compact) + '\n');
+    for (const OutboxEntry &entry : std::as_const(m_entries)) {
+        file.write(QJsonDocument(entryRecord(entry)).toJson(QJsonDocument::Compact) + '\n');
+    }
+
+    if (!file.commit()) {
+        qDebug() << "[TCP] 오프라인 송신함 저장 실패:" << file.errorString();
+        return false;
+    }
+
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qDebug() << "[TCP] 오프라인 송신함 열기 실패:" << m_file.errorString();
+        return false;
+    }
+    m_deadRecords = 0;
+    return true;
+}
+
+/**
+ * @brief 항목 → add 레코드 변환
+ * @param entry 항목
+ * @return 레코드
+ */
+QJsonObject OfflineOutbox::entryRecord(const OutboxEntry &entry)
+{
+    QJsonObject record;
+    record["op"] = "add";
+    record["key"] = entry.key;
+    record["group"] = entry.group;
+    record["replaces"] = entry.replacesGroup;
+    record["queued_at"] = entry.queuedAt.toString(Qt::ISODateWithMs);
+    record["message"] = entry.message;
+    return record;
+}
+
+/**
+ * @brief 멱등 키로 항목 인덱스 찾기
+ * @param key 멱등 키
+ * @return 인덱스 (없으면 -1)
+ */
+int OfflineOutbox::indexOf(const QString &key) const
+{
+    for (int i = 0; i < m_entries.size(); ++i) {
+        if (m_entries.at(i).key == key) {
+            return i;
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,116 @@
+#ifndef OFFLINEOUTBOX_H
+#define OFFLINEOUTBOX_H
+
+#include <QDateTime>
+#include <QFile>
+#include <QJsonObject>
+#include <QList>
+#include <QString>
+
+/**
+ * @brief 오프라인 송신함 항목
+ */
+struct OutboxEntry {
+    QString key;                // 멱등 키 (메시지의 "idempotency_key")
+    QString group;              // 압축 그룹 (같은 그룹의 교체 요청이 이전 항목을 대체)
+    bool replacesGroup = false; // 그룹 전체 교체 요청 여부 (선 일괄 교체, 전체 삭제)
+    QJsonObject message;        // 전송할 메시지
+    QDateTime queuedAt;         // 보관 시각 (UTC)
+};
+
+/**
+ * @brief 디스크 기반 오프라인 송신함
+ * @details 서버 상태를 바꾸는 요청을 추가 전용 파일(JSON 한 줄당 레코드 하나)에 기록해 두었다가
+ *          재연결 시 순서대로 다시 보냅니다. 레코드는 추가(add), 전달 확인(ack), 대체(drop) 세 종류이며,
+ *          로드할 때 순서대로 재생해 남은 항목을 복원합니다. 마지막 줄이 쓰다 만 상태면 버립니다.
+ *          그룹 전체를 바꾸는 요청이 들어오면 같은 그룹의 이전 항목은 보낼 필요가 없으므로 대체 처리하고,
+ *          죽은 레코드가 쌓이면 파일을 남은 항목만으로 다시 씁니다. 네트워크 스레드에서만 사용합니다.
+ */
+class OfflineOutbox
+{
+public:
+    /**
+     * @brief OfflineOutbox 생성자
+     */
+    OfflineOutbox();
+
+    /**
+     * @brief 송신함 파일 열기
+     * @details 기존 파일이 있으면 남은 항목을 복원하고 압축해 다시 씁니다.
+     * @param filePath 파일 경로 (빈 문자열이면 닫기)
+     * @return 성공 여부
+     */
+    bool open(const QString &filePath);
+    /**
+     * @brief 송신함 파일 닫기 (메모리 항목도 비움)
+     */
+    void close();
+    /**
+     * @brief 열려 있는지 여부
+     * @return 열려 있으면 true
+     */
+    bool isOpen() const { return m_file.isOpen(); }
+    /**
+     * @brief 송신함 파일 경로 반환
+     * @return 파일 경로
+     */
+    QString filePath() const { return m_file.fileName(); }
+
+    /**
+     * @brief 요청 보관
+     * @details 메시지에 멱등 키를 넣어 기록합니다. replacesGroup이면 같은 그룹의 이전 항목을 대체합니다.
+     * @param message 전송할 메시지
+     * @param group 압축 그룹
+     * @param replacesGroup 그룹 전체 교체 요청 여부
+     * @return 멱등 키 (기록 실패 시 빈 문자열)
+     */
+    QString append(const QJsonObject &message, const QString &group, bool replacesGroup);
+    /**
+     * @brief 전달 확인된 항목 제거
+     * @param key 멱등 키
+     * @return 항목이 있었으면 true
+     */
+    bool acknowledge(const QString &key);
+
+    /**
+     * @brief 남은 항목 반환 (보관 순서)
+     * @return 항목 리스트
+     */
+    const QList<OutboxEntry> &entries() const { return m_entries; }
+    /**
+     * @brief 비어 있는지 여부
+     * @return 비어 있으면 true
+     */
+    bool isEmpty() const { return m_entries.isEmpty(); }
+    /**
+     * @brief 남은 항목 수
+     * @return 항목 수
+     */
+    int size() const { return m_entries.size(); }
+    /**
+     * @brief 대체되어 보내지 않은 누적 항목 수
+     * @return 항목 수
+     */
+    int supersededCount() const { return m_superseded; }
+
+private:
+    /** @brief 레코드 한 줄 추가 */
+    bool writeRecord(const QJsonObject &record);
+    /** @brief 남은 항목만으로 파일 다시 쓰기 */
+    bool rewrite();
+    /** @brief 항목 → add 레코드 변환 */
+    static QJsonObject entryRecord(const OutboxEntry &entry);
+    /** @brief 멱등 키로 항목 인덱스 찾기 */
+    int indexOf(const QString &key) const;
+
+    /** @brief 송신함 파일 (추가 모드) */
+    QFile m_file;
+    /** @brief 남은 항목 (보관 순서) */
+    QList<OutboxEntry> m_entries;
+    /** @brief 파일에서 더 이상 의미 없는 레코드 수 (ack/drop과 그 대상) */
+    int m_deadRecords;
+    /** @brief 대체되어 보내지 않은 누적 항목 수 */
+    int m_superseded;
+};
+
+#endif // OFFLINEOUTBOX_H
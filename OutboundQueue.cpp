@@ -0,0 +1,106 @@
+#include "OutboundQueue.h"
+
+/**
+ * @brief OutboundQueue 생성자
+ */
+OutboundQueue::OutboundQueue()
+    : m_depth(0)
+    , m_bytes(0)
+    , m_totalWaitUs(0)
+    , m_maxWaitUs(0)
+    , m_sentFrames(0)
+    , m_sentBatches(0)
+    , m_peakDepth(0)
+{
+    m_clock.start();
+}
+
+/**
+ * @brief 프레임 추가
+ * @param frame 길이 프리픽스가 포함된 완성 프레임
+ * @param priority 송신 우선순위
+ */
+void OutboundQueue::enqueue(const QByteArray &frame, SendPriority priority)
+{
+    m_lanes[static_cast<int>(priority)].enqueue(Frame{frame, m_clock.nsecsElapsed()});
+    m_depth++;
+    m_bytes += frame.size();
+    m_peakDepth = qMax(m_peakDepth, m_depth);
+}
+
+/**
+ * @brief 우선순위 순으로 프레임을 꺼내 하나의 버퍼로 합치기
+ * @param maxBytes 합칠 최대 바이트 수
+ * @param frameCount 합친 프레임 수 (출력)
+ * @return 합쳐진 송신 버퍼
+ */
+QByteArray OutboundQueue::takeBatch(qint64 maxBytes, int *frameCount)
+{
+    QByteArray batch;
+    int taken = 0;
+    const qint64 nowNs = m_clock.nsecsElapsed();
+
+    for (QQueue<Frame> &lane : m_lanes) {
+        while (!lane.isEmpty()) {
+            const Frame &front = lane.head();
+            if (taken > 0 && batch.size() + front.bytes.size() > maxBytes) {
+                break;
+            }
+
+            Frame frame = lane.dequeue();
+            if (taken == 0) {
+                // 단일 프레임이면 암시적 공유로 복사 없이 반환
+                batch = frame.bytes;
+            } else {
+                batch.append(frame.bytes);
+            }
+            taken++;
+
+            const qint64 waitUs = (nowNs - frame.enqueuedNs) / 1000;
+            m_totalWaitUs += waitUs;
+            m_maxWaitUs = qMax(m_maxWaitUs, waitUs);
+            m_depth--;
+            m_bytes -= frame.bytes.size();
+        }
+        if (taken > 0 && !lane.isEmpty()) {
+            // 상위 레인이 남았으면 하위 레인을 먼저 보내지 않음
+            break;
+        }
+    }
+
+    if (taken > 0) {
+        m_sentFrames += taken;
+        m_sentBatches++;
+    }
+    if (frameCount) {
+        *frameCount = taken;
+    }
+    return batch;
+}
+
+/**
+ * @brief 큐 비우기
+ * @return 버린 프레임 수
+ */
+int OutboundQueue::clear()
+{
+    const int dropped = m_depth;
+    for (QQueue<Frame> &lane : m_lanes) {
+        lane.clear();
+    }
+    m_depth = 0;
+    m_bytes = 0;
+    return dropped;
+}
+
+/**
+ * @brief 대기 시간 통계 초기화
+ */
+void OutboundQueue::resetStats()
+{
+    m_totalWaitUs = 0;
+    m_maxWaitUs = 0;
+    m_sentFrames = 0;
+    m_sentBatches = 0;
+    m_peakDepth = m_depth;
+}
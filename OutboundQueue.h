@@ -0,0 +1,136 @@
+#ifndef OUTBOUNDQUEUE_H
+#define OUTBOUNDQUEUE_H
+
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QList>
+#include <QQueue>
+
+/**
+ * @brief 송신 우선순위
+ * @details 값이 작을수록 먼저 전송됩니다.
+ */
+enum class SendPriority {
+    Control = 0,        // BBox ON/OFF, 인코딩 협상 등 짧은 제어 프레임
+    Interactive = 1,    // 로그인/조회처럼 사용자가 응답을 기다리는 요청
+    Bulk = 2            // 선 업로드 등 대용량 전송
+};
+
+/**
+ * @brief 우선순위 송신 큐
+ * @details 길이 프리픽스까지 포함된 완성 프레임을 우선순위 레인별로 보관하고, 꺼낼 때는
+ *          높은 우선순위부터 여러 프레임을 하나의 버퍼로 합쳐 한 번의 write()로 보낼 수 있게 합니다.
+ *          대량 전송 뒤에 제어 프레임이 줄 서지 않도록 소켓에는 필요한 만큼만 넘깁니다.
+ */
+class OutboundQueue
+{
+public:
+    /** @brief 우선순위 레인 수 */
+    static constexpr int LaneCount = 3;
+
+    /**
+     * @brief OutboundQueue 생성자
+     */
+    OutboundQueue();
+
+    /**
+     * @brief 프레임 추가
+     * @param frame 길이 프리픽스가 포함된 완성 프레임
+     * @param priority 송신 우선순위
+     */
+    void enqueue(const QByteArray &frame, SendPriority priority);
+    /**
+     * @brief 우선순위 순으로 프레임을 꺼내 하나의 버퍼로 합치기
+     * @details 첫 프레임은 크기와 관계없이 꺼내고, 이후 프레임은 maxBytes를 넘지 않는 동안만 합칩니다.
+     * @param maxBytes 합칠 최대 바이트 수
+     * @param frameCount 합친 프레임 수 (출력)
+     * @return 합쳐진 송신 버퍼
+     */
+    QByteArray takeBatch(qint64 maxBytes, int *frameCount = nullptr);
+    /**
+     * @brief 대기 프레임 수 반환
+     * @return 프레임 수
+     */
+    int depth() const { return m_depth; }
+    /**
+     * @brief 레인별 대기 프레임 수 반환
+     * @param priority 송신 우선순위
+     * @return 프레임 수
+     */
+    int depth(SendPriority priority) const { return m_lanes[static_cast<int>(priority)].size(); }
+    /**
+     * @brief 대기 바이트 수 반환
+     * @return 바이트 수
+     */
+    qint64 bytes() const { return m_bytes; }
+    /**
+     * @brief 큐가 비었는지 여부
+     * @return 비었으면 true
+     */
+    bool isEmpty() const { return m_depth == 0; }
+    /**
+     * @brief 큐 비우기
+     * @return 버린 프레임 수
+     */
+    int clear();
+
+    /**
+     * @brief 통계 구간의 최대 대기 시간 반환
+     * @return 최대 대기 시간(us)
+     */
+    qint64 maxWaitUs() const { return m_maxWaitUs; }
+    /**
+     * @brief 통계 구간의 평균 대기 시간 반환
+     * @return 평균 대기 시간(us)
+     */
+    qint64 averageWaitUs() const { return m_sentFrames > 0 ? m_totalWaitUs / m_sentFrames : 0; }
+    /**
+     * @brief 통계 구간에 전송한 프레임 수 반환
+     * @return 프레임 수
+     */
+    int sentFrames() const { return m_sentFrames; }
+    /**
+     * @brief 통계 구간에 만든 배치 수 반환
+     * @return 배치 수
+     */
+    int sentBatches() const { return m_sentBatches; }
+    /**
+     * @brief 통계 구간의 최대 대기 프레임 수 반환
+     * @return 프레임 수
+     */
+    int peakDepth() const { return m_peakDepth; }
+    /**
+     * @brief 대기 시간 통계 초기화
+     */
+    void resetStats();
+
+private:
+    /**
+     * @brief 대기 중인 프레임
+     */
+    struct Frame {
+        QByteArray bytes;       // 완성 프레임
+        qint64 enqueuedNs;      // 큐 진입 시각 (m_clock 기준)
+    };
+
+    /** @brief 우선순위별 레인 */
+    QQueue<Frame> m_lanes[LaneCount];
+    /** @brief 대기 시간 측정용 시계 */
+    QElapsedTimer m_clock;
+    /** @brief 대기 프레임 수 */
+    int m_depth;
+    /** @brief 대기 바이트 수 */
+    qint64 m_bytes;
+    /** @brief 통계 - 누적 대기 시간(us) */
+    qint64 m_totalWaitUs;
+    /** @brief 통계 - 최대 대기 시간(us) */
+    qint64 m_maxWaitUs;
+    /** @brief 통계 - 전송 프레임 수 */
+    int m_sentFrames;
+    /** @brief 통계 - 배치 수 */
+    int m_sentBatches;
+    /** @brief 통계 - 최대 대기 프레임 수 */
+    int m_peakDepth;
+};
+
+#endif // OUTBOUNDQUEUE_H
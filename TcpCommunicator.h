@@ -12,9 +12,24 @@
 #include <QSslSocket>
 #include <QSslError>
 #include <QSslConfiguration>
+#include <QCborMap>
+#include <QElapsedTimer>
+#include <QFuture>
+#include <QPromise>
+#include <QHash>
+#include <QStringList>
+#include <atomic>
+#include <functional>
+#include <memory>
 
-// Forward declarations
-class VideoGraphicsView;
+#include "FrameCodec.h"
+#include "BBoxMailbox.h"
+#include "BBoxTrackTable.h"
+#include "MessageFields.h"
+#include "OfflineOutbox.h"
+#include "OutboundQueue.h"
+
+class ImageDecodePool;
 
 /**
  * @brief 메시지 타입 열거형
@@ -29,9 +44,40 @@ enum class MessageType {
     ERROR_RESPONSE
 };
 
+/**
+ * @brief 메시지 인코딩 열거형
+ * @details 연결 직후 서버와 협상한 페이로드 인코딩 (기본값 JSON)
+ */
+enum class WireFormat {
+    Json,   // QJsonDocument Compact 텍스트
+    Cbor    // QCborValue 바이너리 (이미지는 raw 바이트 문자열)
+};
+
+/**
+ * @brief 연결 상태 열거형
+ * @details 비블로킹 연결 상태 머신의 단계
+ */
+enum class ConnectionState {
+    Disconnected,   // 연결 없음 (사용자 해제 또는 재연결 비활성)
+    Connecting,     // TCP 연결 시도 중
+    Handshaking,    // TLS 핸드셰이크 중
+    Connected,      // 암호화 연결 수립 완료
+    BackingOff      // 재연결 대기 중 (지수 백오프)
+};
+
+/**
+ * @brief 서버 엔드포인트 구조체
+ * @details 페일오버 순서대로 시도할 서버 주소
+ */
+struct ServerEndpoint {
+    QString host;
+    quint16 port = 0;
+};
+
 /**
  * @brief 이미지 데이터 구조체
  * @details 이미지 경로, 타임스탬프, 로그, 탐지 타입, 방향 정보 포함
+ *          imageId가 있으면 imagePath는 썸네일이며, 원본은 requestFullImage()로 받습니다.
  */
 struct ImageData {
     QString imagePath;
@@ -39,6 +85,7 @@ struct ImageData {
     QString logText;
     QString detectionType;
     QString direction;
+    QString imageId;
 };
 
 /**
@@ -54,17 +101,6 @@ struct DetectionLineData {
     int rightMatrixNum;
 };
 
-/**
- * @brief BBox 데이터 구조체
- * @details 객체 ID, 타입, 신뢰도, 바운딩 박스 영역 포함
- */
-struct BBox {
-    int object_id;          // 객체 ID
-    QString type;           // 객체 타입 (예: "Vehicle", "Person" 등)
-    double confidence;      // 신뢰도 (0.0 ~ 1.0)
-    QRect rect;            // 바운딩 박스 영역 (x, y, width, height)
-};
-
 /**
  * @brief 도로 기준선 데이터 구조체 (서버 양식)
  * @details 기준선 번호, 매트릭스 번호, 좌표 포함
@@ -77,9 +113,128 @@ struct RoadLineData {
     int x2, y2;
 };
 
+/**
+ * @brief 이미지 데이터 서버 양식 (image 본문은 스트리밍 디코더가 따로 처리)
+ */
+template <>
+struct MessageFields<ImageData> {
+    static constexpr auto fields = std::make_tuple(
+        messageField("timestamp", &ImageData::timestamp),
+        messageField("detection_type", &ImageData::detectionType),
+        messageField("direction", &ImageData::direction),
+        messageField("image_id", &ImageData::imageId));
+};
+
+/**
+ * @brief 객체 탐지선 서버 양식
+ */
+template <>
+struct MessageFields<DetectionLineData> {
+    static constexpr auto fields = std::make_tuple(
+        messageField("index", &DetectionLineData::index),
+        messageField("x1", &DetectionLineData::x1),
+        messageField("x2", &DetectionLineData::x2),
+        messageField("y1", &DetectionLineData::y1),
+        messageField("y2", &DetectionLineData::y2),
+        messageField("name", &DetectionLineData::name),
+        messageField("mode", &DetectionLineData::mode));
+};
+
+/**
+ * @brief 도로 기준선 서버 양식
+ */
+template <>
+struct MessageFields<RoadLineData> {
+    static constexpr auto fields = std::make_tuple(
+        messageField("index", &RoadLineData::index),
+        messageField("matrixNum1", &RoadLineData::matrixNum1),
+        messageField("x1", &RoadLineData::x1),
+        messageField("y1", &RoadLineData::y1),
+        messageField("matrixNum2", &RoadLineData::matrixNum2),
+        messageField("x2", &RoadLineData::x2),
+        messageField("y2", &RoadLineData::y2));
+};
+
+/**
+ * @brief BBox 서버 양식
+ */
+template <>
+struct MessageFields<BBox> {
+    static constexpr auto fields = std::make_tuple(
+        messageField("id", &BBox::object_id),
+        messageField("type", &BBox::type),
+        messageField("confidence", &BBox::confidence),
+        messageRectField("x", &BBox::rect, MessageRectField<BBox>::X),
+        messageRectField("y", &BBox::rect, MessageRectField<BBox>::Y),
+        messageRectField("width", &BBox::rect, MessageRectField<BBox>::Width),
+        messageRectField("height", &BBox::rect, MessageRectField<BBox>::Height));
+};
+
+/**
+ * @brief RTT 히스토그램 구간 상한(ms)
+ * @details 마지막 구간은 1000ms 초과입니다.
+ */
+constexpr int RttHistogramBoundsMs[] = {10, 25, 50, 100, 250, 500, 1000};
+
+/**
+ * @brief 하트비트 왕복 시간 통계 구조체
+ * @details 현재 연결에서 최근 핑/퐁 샘플로 계산한 백분위수와 히스토그램
+ */
+struct RttStats {
+    int samples = 0;            // 통계에 사용된 샘플 수
+    qint64 lastMs = 0;          // 마지막 RTT(ms)
+    qint64 p50Ms = 0;           // 중앙값(ms)
+    qint64 p90Ms = 0;           // 90 백분위수(ms)
+    qint64 p99Ms = 0;           // 99 백분위수(ms)
+    qint64 maxMs = 0;           // 최대값(ms)
+    int missedPongs = 0;        // 응답 없이 지나간 핑 수
+    QList<int> histogram;       // RttHistogramBoundsMs 구간별 개수 (+ 초과 구간)
+};
+
+/**
+ * @brief 요청 처리 결과 구조체
+ * @details sendRequest() 계열이 반환하는 QFuture의 결과. 이미지 응답(10)의 data[]는
+ *          imageReceived/imagesReceived 시그널로 전달되므로 payload에서 제외됩니다.
+ */
+struct TcpResponse {
+    bool success = false;       // 응답(또는 응답 없는 요청의 전송) 완료 여부
+    bool timedOut = false;      // 마감 시간 초과 여부
+    int requestId = 0;          // 요청 ID
+    int responseId = 0;         // 응답 ID
+    quint32 seq = 0;            // 상관 ID
+    qint64 latencyMs = 0;       // 요청 ~ 응답 지연(ms)
+    QString error;              // 실패 사유
+    QJsonObject payload;        // 응답 메시지
+    QByteArray data;            // 이진 본문 (원본 이미지 응답 71의 이미지 바이트, payload에서는 빠짐)
+};
+
+/**
+ * @brief 이미지 페이지 정보
+ * @details 페이지 요청 응답(10)의 "next_cursor"와 "total_count"를 담습니다. 페이지를 모르는
+ *          구버전 서버는 전체를 한 번에 보내고 커서를 주지 않으므로 마지막 페이지로 취급됩니다.
+ */
+struct ImagePageInfo {
+    QString nextCursor;         // 다음 페이지 커서 (비어 있으면 마지막 페이지)
+    int totalCount = -1;        // 조건에 맞는 전체 이미지 수 힌트 (모르면 -1)
+
+    /** @brief 다음 페이지가 있는지 여부 */
+    bool hasMore() const { return !nextCursor.isEmpty(); }
+};
+
+// 네트워크 스레드 → GUI 스레드 큐 시그널 전달용 메타타입
+Q_DECLARE_METATYPE(ImageData)
+Q_DECLARE_METATYPE(DetectionLineData)
+Q_DECLARE_METATYPE(BBox)
+Q_DECLARE_METATYPE(RoadLineData)
+Q_DECLARE_METATYPE(ConnectionState)
+Q_DECLARE_METATYPE(RttStats)
+
 /**
  * @brief TCP 통신 및 데이터 관리 클래스
- * @details 서버와의 연결, 메시지 송수신, 선/이미지 데이터 관리 등 담당
+ * @details 서버와의 연결, 메시지 송수신, 선/이미지 데이터 관리 등 담당.
+ *          전용 네트워크 스레드로 moveToThread하여 사용하며, TLS 복호화/프레이밍/파싱/
+ *          이미지 저장은 모두 해당 스레드에서 수행하고 디코딩된 결과만 큐 시그널로 전달합니다.
+ *          공개 메서드는 다른 스레드에서 호출되면 네트워크 스레드로 큐잉됩니다.
  */
 class TcpCommunicator : public QObject
 {
@@ -102,6 +257,26 @@ public:
      * @param port 포트 번호
      */
     void connectToServer(const QString &host, quint16 port);
+    /**
+     * @brief 여러 서버 엔드포인트에 순서대로 연결 (페일오버)
+     * @details 블로킹 없이 첫 엔드포인트부터 시도하고, 실패하면 다음 엔드포인트로 넘어갑니다.
+     *          모두 실패하면 지수 백오프 + 지터 후 처음부터 다시 시도합니다.
+     * @param endpoints 우선순위 순 엔드포인트 리스트
+     */
+    void connectToServers(const QList<ServerEndpoint> &endpoints);
+    /**
+     * @brief 현재 연결 상태 반환
+     * @return 연결 상태
+     */
+    ConnectionState connectionState() const { return m_connectionState.load(); }
+    /**
+     * @brief 엔드포인트 목록 문자열 파싱
+     * @details "host1:port1,host2,host3:port3" 형식 (포트 생략 시 기본 포트)
+     * @param spec 엔드포인트 목록 문자열 (.env TCP_HOSTS)
+     * @param defaultPort 기본 포트
+     * @return 엔드포인트 리스트
+     */
+    static QList<ServerEndpoint> parseServerEndpoints(const QString &spec, quint16 defaultPort);
     /**
      * @brief 서버 연결 해제
      */
@@ -118,6 +293,50 @@ public:
      * @return 성공 여부
      */
     bool sendJsonMessage(const QJsonObject &message);
+    /**
+     * @brief 응답을 기다리는 요청 전송
+     * @details 모든 송신 프레임에는 상관 ID("seq")가 붙고, 응답이 정의된 요청은 대기 테이블에
+     *          등록되어 응답 수신 또는 마감 시간 초과 시 QFuture가 완료됩니다.
+     *          여러 요청을 한 연결에서 파이프라이닝할 수 있으며 이벤트 루프를 막지 않습니다.
+     * @param message 전송할 JSON 객체
+     * @param timeoutMs 응답 마감 시간(ms), 음수면 기본값
+     * @param seq 부여된 상관 ID를 받을 위치 (선택, 호출 스레드에서 바로 채워짐)
+     * @return 요청 결과 future
+     */
+    QFuture<TcpResponse> sendRequest(const QJsonObject &message, int timeoutMs = -1, quint32 *seq = nullptr);
+
+    /** @brief JSON 수신 메시지 처리기 */
+    using JsonMessageHandler = std::function<void(const QJsonObject &)>;
+    /** @brief CBOR 수신 메시지 처리기 */
+    using CborMessageHandler = std::function<void(const QCborMap &)>;
+    /**
+     * @brief 수신 메시지 처리기 등록
+     * @details 같은 ID를 다시 등록하면 교체됩니다. CBOR 처리기가 없으면 CBOR 메시지는 JSON으로
+     *          변환되어 JSON 처리기로 전달됩니다. 처리기는 네트워크 스레드에서 호출됩니다.
+     * @param responseId request_id/response_id
+     * @param jsonHandler JSON 처리기
+     * @param cborHandler CBOR 처리기 (선택)
+     */
+    void registerMessageHandler(int responseId, JsonMessageHandler jsonHandler, CborMessageHandler cborHandler = {});
+    /**
+     * @brief 송신 큐에 대기 중인 프레임 수 반환
+     * @return 프레임 수
+     */
+    int sendQueueDepth() const { return m_sendQueueDepth.load(); }
+    /**
+     * @brief 카메라의 최신 BBox 변경분 꺼내기
+     * @details bboxFrameReady 이후 화면 표시 주기마다 호출합니다. 어느 스레드에서 호출해도 됩니다.
+     * @param cameraId 카메라 ID
+     * @param delta 변경분 (출력)
+     * @param timestamp 마지막 프레임의 타임스탬프 (출력)
+     * @return 꺼낼 변경분이 있었으면 true
+     */
+    bool takeBBoxFrame(const QString &cameraId, BBoxDelta *delta, qint64 *timestamp);
+    /**
+     * @brief 현재 협상된 메시지 인코딩 반환
+     * @return 인코딩
+     */
+    WireFormat wireFormat() const { return m_wireFormat; }
 
     /**
      * @brief 탐지선 데이터 전송
@@ -144,23 +363,72 @@ public:
      * @return 성공 여부
      */
     bool sendMultipleRoadLines(const QList<RoadLineData> &roadLines);
+    /**
+     * @brief 도로선/감지선 전체를 한 프레임으로 일괄 교체 전송
+     * @details 서버가 "line_set" 기능을 지원하면 request_id 50 한 번으로 보내고 선별 결과가 담긴
+     *          응답(51)을 categorizedCoordinatesConfirmed로 전달합니다. 지원하지 않는 구버전 서버는
+     *          선별 전송(sendMultipleRoadLines/sendMultipleDetectionLines)으로 대체합니다.
+     * @param roadLines 도로선 데이터 리스트
+     * @param detectionLines 감지선 데이터 리스트
+     * @return 성공 여부
+     */
+    bool sendLineSet(const QList<RoadLineData> &roadLines, const QList<DetectionLineData> &detectionLines);
     /**
      * @brief 이미지 데이터 요청
      * @param date 날짜(선택)
      * @param hour 시간(선택)
+     * @param timeoutMs 응답 마감 시간(ms), 음수면 기본값
+     * @return 요청 결과 future (응답 10)
      */
-    void requestImageData(const QString &date = QString(), int hour = -1);
+    QFuture<TcpResponse> requestImageData(const QString &date = QString(), int hour = -1, int timeoutMs = -1);
+    /**
+     * @brief 이미지 데이터 페이지 요청
+     * @details 시간 범위 안의 이미지를 최대 pageSize장만 요청합니다. 응답의 next_cursor를 다음 요청의
+     *          cursor로 넘기면 이어지는 페이지를 받으며, 이미지 자체는 requestImageData()와 같이
+     *          imageStreamStarted/imageReceived/imagesReceived 시그널로 전달됩니다.
+     * @param date 날짜(선택)
+     * @param hour 시간(선택, 음수면 하루 전체)
+     * @param pageSize 페이지 크기 (0 이하면 전체)
+     * @param cursor 이전 응답의 next_cursor (첫 페이지는 빈 문자열)
+     * @param timeoutMs 응답 마감 시간(ms), 음수면 기본값
+     * @param seq 요청의 상관 ID를 받을 위치 (선택, imageStreamStarted의 seq와 비교)
+     * @return 요청 결과 future (응답 10, imagePageInfo()로 페이지 정보 확인)
+     */
+    QFuture<TcpResponse> requestImagePage(const QString &date, int hour, int pageSize,
+                                          const QString &cursor = QString(), int timeoutMs = -1,
+                                          quint32 *seq = nullptr);
+    /**
+     * @brief 이미지 응답의 페이지 정보 반환
+     * @param response requestImagePage() 결과
+     * @return 페이지 정보
+     */
+    static ImagePageInfo imagePageInfo(const TcpResponse &response);
+    /**
+     * @brief 원본 이미지 요청
+     * @details 이미지 목록은 썸네일과 image_id만 담아 오므로, 뷰어에서 열 때 원본을 따로 받습니다.
+     * @param imageId 이미지 ID (ImageData::imageId)
+     * @param timeoutMs 응답 마감 시간(ms), 음수면 기본값
+     * @return 요청 결과 future (응답 71, fullImageBytes()로 이미지 바이트 확인)
+     */
+    QFuture<TcpResponse> requestFullImage(const QString &imageId, int timeoutMs = -1);
+    /**
+     * @brief 원본 이미지 응답의 이미지 바이트 반환
+     * @details 이미지는 네트워크 스레드에서 수신 프레임으로부터 바로 디코딩해 두므로 복사만 합니다.
+     * @param response requestFullImage() 결과
+     * @return 이미지 바이트 (JPEG, 실패 시 빈 배열)
+     */
+    static QByteArray fullImageBytes(const TcpResponse &response);
 
     /**
      * @brief 저장된 도로선 데이터 요청
-     * @return 성공 여부
+     * @return 요청 결과 future (응답 16)
      */
-    bool requestSavedRoadLines();
+    QFuture<TcpResponse> requestSavedRoadLines();
     /**
      * @brief 저장된 감지선 데이터 요청
-     * @return 성공 여부
+     * @return 요청 결과 future (응답 12)
      */
-    bool requestSavedDetectionLines();
+    QFuture<TcpResponse> requestSavedDetectionLines();
     /**
      * @brief 저장된 선 데이터 삭제 요청
      * @return 성공 여부
@@ -178,22 +446,92 @@ public:
      */
     void setReconnectEnabled(bool enabled);
     /**
-     * @brief 비디오 뷰 설정
-     * @param videoView VideoGraphicsView 포인터
+     * @brief TLS 세션 캐시 파일 설정
+     * @details 재연결 시 TLS 세션 티켓을 재사용해 전체 핸드셰이크를 생략합니다. 캐시는 항상
+     *          메모리에 유지되며, 경로를 지정하면 프로그램 재시작 후에도 사용하도록 디스크에 저장합니다.
+     * @param filePath 캐시 파일 경로 (빈 문자열이면 메모리 캐시만 사용)
+     */
+    void setSessionCacheFile(const QString &filePath);
+    /**
+     * @brief 오프라인 송신함 파일 설정
+     * @details 지정하면 선 일괄 교체/선별 전송/전체 삭제 요청을 먼저 파일에 기록한 뒤 보내고,
+     *          연결이 없을 때도 실패하지 않고 보관해 두었다가 재연결 후 순서대로 다시 보냅니다.
+     * @param filePath 송신함 파일 경로 (빈 문자열이면 사용 안 함)
+     */
+    void setOfflineOutboxFile(const QString &filePath);
+    /**
+     * @brief 오프라인 송신함 사용 여부
+     * @return 사용 중이면 true (연결이 없어도 선 편집 요청을 받음)
+     */
+    bool isOfflineOutboxEnabled() const { return m_outboxEnabled.load(); }
+    /**
+     * @brief 프레임 압축 기준 크기 설정
+     * @details 서버가 "frame_compression"을 지원할 때, 직렬화된 페이로드가 이 크기 이상이면
+     *          qCompress(zlib)로 압축하고 길이 헤더의 최상위 비트로 표시합니다.
+     * @param thresholdBytes 기준 크기(바이트), 0 이하면 송신 압축 사용 안 함
+     */
+    void setCompressionThreshold(int thresholdBytes);
+    /**
+     * @brief 하트비트 설정
+     * @details 서버가 "heartbeat"를 지원하면 주기적으로 핑(60)을 보내 RTT를 측정하고,
+     *          기준 시간 동안 아무 데이터도 받지 못하면 연결을 끊고 재연결합니다.
+     * @param intervalMs 핑 주기(ms), 0 이하면 하트비트 사용 안 함
+     * @param deadPeerTimeoutMs 무응답 판정 시간(ms)
+     */
+    void setHeartbeat(int intervalMs, int deadPeerTimeoutMs);
+    /**
+     * @brief 수신 프레임 크기 상한 설정
+     * @details 메모리 상한을 넘는 프레임은 RAM에 모으지 않고 임시 파일에 쓴 뒤 메모리 매핑에서
+     *          이미지 원소 단위로 디코딩하며, 스트리밍 이미지 원소도 이 크기를 넘으면 건너뜁니다.
+     *          원소 단위로 나눌 수 없는 프레임(압축, CBOR, 다른 메시지)이 메모리 상한을 넘거나
+     *          길이 헤더가 절대 상한을 넘으면 오류로 보고 연결을 재설정합니다.
+     * @param maxInMemoryBytes 메모리 상한(바이트)
+     * @param maxFrameBytes 절대 상한(바이트)
+     */
+    void setFrameLimits(qint64 maxInMemoryBytes, qint64 maxFrameBytes);
+    /**
+     * @brief 이미지 디코딩/저장 작업 스레드 수 설정
+     * @details 이미지 응답의 원소마다 base64 디코딩과 파일 저장을 작업 스레드에 나눠 맡기며,
+     *          imageReceived는 스레드 수와 관계없이 받은 순서대로 발신됩니다.
+     * @param threads 스레드 수 (0 이하면 CPU 코어 수)
+     */
+    void setImageDecodeThreads(int threads);
+    /**
+     * @brief 실시간 캡처 구독 설정
+     * @details 구독 중이면 서버가 새 경고 캡처를 저장할 때마다 메타데이터와 썸네일을 푸시(210)하고,
+     *          liveCaptureReceived 시그널로 한 장씩 전달됩니다. 재연결 시 자동으로 다시 구독합니다.
+     * @param enabled 구독 여부
      */
-    void setVideoView(VideoGraphicsView* videoView);
+    void setCaptureSubscription(bool enabled);
 
 signals:
     /** @brief 서버 연결됨 */
     void connected();
     /** @brief 서버 연결 해제됨 */
     void disconnected();
+    /** @brief 연결 상태 변경 (endpoint: "host:port") */
+    void connectionStateChanged(ConnectionState state, const QString &endpoint);
+    /** @brief 재연결 예약됨 */
+    void reconnectScheduled(int delayMs, int attempt);
+    /** @brief 하트비트 RTT 통계 갱신 */
+    void rttUpdated(const RttStats &stats);
     /** @brief 에러 발생 */
     void errorOccurred(const QString &error);
     /** @brief 메시지 수신 */
     void messageReceived(const QString &message);
-    /** @brief 이미지 데이터 수신 */
+    /**
+     * @brief 이미지 응답 수신 시작 (스트리밍)
+     * @param seq 응답의 상관 ID (서버가 data 앞에 보내지 않았으면 0)
+     */
+    void imageStreamStarted(quint32 seq);
+    /** @brief 이미지 한 장 디코딩 완료 (스트리밍) */
+    void imageReceived(const ImageData &image);
+    /** @brief 이미지 데이터 수신 (응답 전체 완료) */
     void imagesReceived(const QList<ImageData> &images);
+    /** @brief 실시간 캡처 한 장 수신 (구독 중 서버 푸시) */
+    void liveCaptureReceived(const ImageData &image);
+    /** @brief 실시간 캡처 구독 상태 변경 (active: 서버가 구독을 받았는지 여부) */
+    void captureSubscriptionChanged(bool active, const QString &message);
     /** @brief 좌표 전송 확인 */
     void coordinatesConfirmed(bool success, const QString &message);
     /** @brief 탐지선 전송 확인 */
@@ -208,8 +546,11 @@ signals:
     void savedDetectionLinesReceived(const QList<DetectionLineData> &detectionLines);
     /** @brief 카테고리별 좌표 전송 확인 */
     void categorizedCoordinatesConfirmed(bool success, const QString &message, int roadLinesProcessed, int detectionLinesProcessed);
-    /** @brief BBox 데이터 수신 */
-    void bboxesReceived(const QList<BBox> &bboxes, qint64 timestamp);
+    /**
+     * @brief BBox 변경분 대기 알림
+     * @details 카메라 칸이 비어 있다가 채워질 때만 발신됩니다. 받는 쪽은 takeBBoxFrame()으로 꺼냅니다.
+     */
+    void bboxFrameReady(const QString &cameraId);
 
 private slots:
     /** @brief 서버 연결 슬롯 */
@@ -218,52 +559,259 @@ private slots:
     void onDisconnected();
     /** @brief 데이터 수신 슬롯 */
     void onReadyRead();
-    /** @brief 에러 슬롯 */
-    void onError(QAbstractSocket::SocketError error);
     /** @brief 연결 타임아웃 슬롯 */
     void onConnectionTimeout();
     /** @brief SSL 암호화 슬롯 */
     void onSslEncrypted();
     /** @brief SSL 에러 슬롯 */
     void onSslErrors(const QList<QSslError> &errors);
-    /** @brief 소켓 연결 슬롯 */
-    void onSocketConnected();
-    /** @brief 소켓 연결 해제 슬롯 */
-    void onSocketDisconnected();
-    /** @brief 소켓 데이터 수신 슬롯 */
-    void onSocketReadyRead();
     /** @brief 소켓 에러 슬롯 */
     void onSocketError(QAbstractSocket::SocketError error);
     /** @brief 재연결 타이머 슬롯 */
     void onReconnectTimer();
+    /** @brief 대기 요청 마감 시간 확인 슬롯 */
+    void onRequestDeadlineCheck();
+    /** @brief TLS 세션 티켓 수신 슬롯 (TLS 1.3은 핸드셰이크 이후 도착) */
+    void onNewSessionTicket();
+    /** @brief 소켓 송신 완료 슬롯 (송신 큐 이어서 비우기) */
+    void onBytesWritten(qint64 bytes);
+    /** @brief 하트비트 타이머 슬롯 (무응답 판정 및 핑 전송) */
+    void onHeartbeatTimer();
 
 private:
-    /** @brief JSON 메시지 처리 */
-    void processJsonMessage(const QJsonObject &jsonObj);
+    /**
+     * @brief 응답 대기 중인 요청
+     */
+    struct PendingRequest {
+        int requestId;                                  // 요청 ID
+        int responseId;                                 // 기다리는 응답 ID
+        int timeoutMs;                                  // 마감 시간(ms)
+        QElapsedTimer elapsed;                          // 전송 후 경과 시간
+        std::shared_ptr<QPromise<TcpResponse>> promise; // 결과 전달 (없으면 통계만 기록)
+    };
+
+    /**
+     * @brief 요청 종류별 응답 지연 통계
+     */
+    struct LatencyStats {
+        int count = 0;          // 응답 수
+        int timeouts = 0;       // 타임아웃 수
+        qint64 totalMs = 0;     // 누적 지연(ms)
+        qint64 maxMs = 0;       // 최대 지연(ms)
+    };
+
+    /**
+     * @brief 엔드포인트별 캐시된 TLS 세션
+     */
+    struct CachedSession {
+        QByteArray ticket;      // 세션 티켓 (재개 비밀 포함, 외부 노출 금지)
+        QDateTime expiresAt;    // 서버가 알려준 유효 기간 만료 시각
+    };
+
+    /** @brief 상관 ID 부여 후 전송 및 대기 테이블 등록 */
+    bool dispatchRequest(QJsonObject message, quint32 seq, const std::shared_ptr<QPromise<TcpResponse>> &promise,
+                         int timeoutMs);
+    /** @brief 직렬화 후 길이 프리픽스 프레임을 송신 큐에 추가 */
+    bool writeMessage(const QJsonObject &message);
+    /** @brief 송신 큐를 소켓 버퍼 상한까지 비우기 */
+    void flushSendQueue();
+    /** @brief 송신 큐 비우기 (연결 해제 시) */
+    void resetSendState();
+    /** @brief 요청 ID별 송신 우선순위 반환 */
+    SendPriority priorityForRequest(int requestId) const;
+    /** @brief 송신 큐 통계 기록 (5초 주기 로그) */
+    void recordSendQueueStats();
+    /** @brief 하트비트 시작 (서버 지원 시) */
+    void startHeartbeat();
+    /** @brief 하트비트 중지 및 RTT 샘플 초기화 */
+    void stopHeartbeat();
+    /** @brief 핑 전송 (request_id 60) */
+    void sendPing();
+    /** @brief 퐁 응답 처리 (response_id 61) */
+    void handlePong(const QJsonObject &jsonObj);
+    /** @brief 현재 RTT 샘플로 통계 계산 */
+    RttStats computeRttStats() const;
+    /** @brief 요청 ID에 대응하는 응답 ID 반환 (응답 없는 요청은 0) */
+    int expectedResponseId(int requestId) const;
+    /** @brief 수신 메시지와 맞는 대기 요청이 있는지 확인 */
+    bool hasPendingRequest(int responseId, quint32 seq) const;
+    /** @brief 수신 메시지로 대기 요청 완료 (data: 메시지에서 떼어 낸 이진 본문) */
+    void completePendingRequest(int responseId, quint32 seq, const QJsonObject &message,
+                                const QByteArray &data = QByteArray());
+    /** @brief 대기 요청 전체 실패 처리 */
+    void failAllPendingRequests(const QString &error);
+    /** @brief 요청 종류별 지연 통계 기록 */
+    void recordLatency(int requestId, qint64 latencyMs, bool timedOut);
+    /** @brief 현재 스레드가 네트워크(소유) 스레드인지 여부 */
+    bool isNetworkThread() const { return QThread::currentThread() == thread(); }
+    /** @brief 디코딩 시간 통계 누적 및 주기적 로깅 */
+    void recordDecodeTime(qint64 elapsedNs, int frames);
+    /**
+     * @brief 압축 프레임 해제
+     * @param payload 압축된 페이로드 (qCompress 형식)
+     * @param error 실패 사유 (실패 시 채움)
+     * @return 해제된 페이로드, 실패 시 빈 배열
+     */
+    QByteArray decompressFrame(const QByteArray &payload, QString &error);
+    /**
+     * @brief 압축 효과 통계 기록 (5초 주기 로그)
+     * @param outgoing 송신 여부
+     * @param rawBytes 원본 크기
+     * @param wireBytes 전송 크기
+     * @param elapsedNs 압축/해제 시간(ns)
+     */
+    void recordCompression(bool outgoing, qint64 rawBytes, qint64 wireBytes, qint64 elapsedNs);
+    /** @brief 기본 수신 메시지 처리기 등록 */
+    void registerDefaultMessageHandlers();
+    /** @brief JSON 메시지 처리 (data: 메시지에서 떼어 낸 이진 본문) */
+    void processJsonMessage(const QJsonObject &jsonObj, const QByteArray &data = QByteArray());
+    /** @brief 수신 프레임 처리 (JSON/CBOR 판별 및 분기) */
+    void processFrame(const QByteArray &messageData);
+    /** @brief CBOR 메시지 처리 */
+    void processCborMessage(const QCborMap &cborMap);
+    /** @brief CBOR 메시지를 JSON 객체로 변환 (71의 "image"는 바이트로 분리) */
+    static QJsonObject cborMessageToJson(const QCborMap &cborMap, int responseId, QByteArray *imageBytes);
+    /** @brief CBOR 이미지 응답 처리 (JSON 요청을 무시한 서버용, 스트리밍 없음) */
+    void handleCborImagesResponse(const QCborMap &cborMap);
+    /** @brief CBOR BBox 응답 처리 */
+    void handleCborBBoxResponse(const QCborMap &cborMap);
+    /** @brief 인코딩 협상 요청 전송 */
+    void sendHello();
+    /** @brief 인코딩 협상 응답 처리 */
+    void handleHelloResponse(const QJsonObject &jsonObj);
+    /** @brief 선 일괄 교체 응답 처리 */
+    void handleLineSetResponse(const QJsonObject &jsonObj);
+    /** @brief 도로선 데이터를 JSON 객체로 변환 */
+    QJsonObject roadLineToJson(const RoadLineData &lineData) const;
+    /** @brief 감지선 데이터를 JSON 객체로 변환 */
+    QJsonObject detectionLineToJson(const DetectionLineData &lineData) const;
     /** @brief 이미지 응답 처리 */
     void handleImagesResponse(const QJsonObject &jsonObj);
+    /** @brief 이미지 배치 시작 (fields: 지금까지 받은 data 외 최상위 필드) */
+    void beginImageBatch(const QJsonObject &fields);
+    /** @brief 이미지 원소 하나 처리 (디코딩/저장은 작업 스레드) */
+    void handleImageElement(const QJsonObject &imageObj);
+    /** @brief 원소 JSON 텍스트로 이미지 원소 하나 처리 (이미지 문자열은 파싱하지 않음) */
+    void handleRawImageElement(const QByteArray &element);
+    /** @brief CBOR 이미지 원소 하나 처리 (디코딩/저장은 작업 스레드) */
+    void handleCborImageElement(const QCborMap &imageMap);
+    /** @brief 이미지 원소의 메타데이터와 본문 추출 */
+    bool extractImageElement(const QJsonObject &imageObj, ImageData &imageData, QByteArray &payload, bool &base64);
+    /** @brief CBOR 이미지 원소의 메타데이터와 본문 추출 */
+    bool extractCborImageElement(const QCborMap &imageMap, ImageData &imageData, QByteArray &payload, bool &base64);
+    /** @brief 실시간 캡처 푸시 처리 (request_id 210) */
+    void handleLiveCapture(const QJsonObject &jsonObj);
+    /** @brief CBOR 실시간 캡처 푸시 처리 (request_id 210) */
+    void handleCborLiveCapture(const QCborMap &cborMap);
+    /** @brief 실시간 캡처 구독 요청 전송 (request_id 80) */
+    void sendCaptureSubscription(bool enabled);
+    /** @brief 이미지 배치 완료 (앞선 원소가 모두 저장된 뒤 onImageBatchFinished) */
+    void finishImageBatch(const QJsonObject &fields);
+    /** @brief 순서대로 시작된 이미지 배치 처리 */
+    void onImageBatchStarted(const QJsonObject &fields);
+    /** @brief 순서대로 저장된 이미지 처리 */
+    void onImageDecoded(const ImageData &imageData);
+    /** @brief 순서대로 완료된 이미지 배치 처리 (대기 요청 완료) */
+    void onImageBatchFinished(const QJsonObject &fields);
+    /** @brief 디코딩 풀에 여유가 생기면 멈췄던 소켓 읽기 재개 */
+    void onImageDecodeCapacityAvailable();
+    /** @brief 디코딩 풀이 가득 차 소켓 읽기 중지 (커널 수신 버퍼와 TCP 흐름 제어로 송신 측을 늦춤) */
+    void pauseSocketReads();
+    /** @brief 코덱이 넘긴 프레임 처리 (압축 해제 후 processFrame) */
+    void handleDecodedFrame(const QByteArray &payload, bool compressed);
+    /** @brief 스트리밍 이미지 응답의 data[] 원소 처리 */
+    void handleStreamedImageElements(const QList<QByteArray> &elements);
+    /** @brief 스트리밍 이미지 응답 종료 처리 */
+    void finishStreamedImages(const QJsonObject &fields, int skippedElements);
     /** @brief 상태 업데이트 처리 */
     void handleStatusUpdate(const QJsonObject &jsonObj);
     /** @brief 에러 응답 처리 */
     void handleErrorResponse(const QJsonObject &jsonObj);
-    /** @brief Base64 이미지 저장 */
-    QString saveBase64Image(const QString &base64Data, const QString &timestamp);
     /** @brief JSON 메시지 로깅 */
     void logJsonMessage(const QJsonObject &jsonObj, bool outgoing) const;
-    /** @brief 재연결 타이머 시작 */
-    void startReconnectTimer();
-    /** @brief 재연결 타이머 중지 */
-    void stopReconnectTimer();
+    /** @brief 현재 엔드포인트로 연결 시도 시작 */
+    void startConnectionAttempt();
+    /** @brief 연결 시도 실패 처리 (다음 엔드포인트 또는 백오프) */
+    void handleConnectionFailure(const QString &reason);
+    /** @brief 지수 백오프 + 지터로 재연결 예약 */
+    void scheduleReconnect();
+    /** @brief 소켓 중단 및 연결 상태 정리 */
+    void resetConnection();
+    /** @brief 연결 상태 변경 및 시그널 발신 */
+    void setConnectionState(ConnectionState state);
     /** @brief SSL 설정 구성 */
     void setupSslConfiguration();
+    /** @brief 현재 엔드포인트의 캐시된 세션 티켓을 소켓에 적용 */
+    void applyCachedSession();
+    /** @brief 현재 소켓의 세션 티켓을 캐시에 저장 */
+    void storeSessionTicket();
+    /** @brief 현재 엔드포인트의 캐시된 세션 제거 */
+    void dropCachedSession();
+    /** @brief 디스크에서 세션 캐시 로드 */
+    void loadSessionCache();
+    /** @brief 디스크에 세션 캐시 저장 */
+    void saveSessionCache() const;
+    /** @brief 현재 엔드포인트 캐시 키 ("host:port") */
+    QString sessionCacheKey() const;
+    /**
+     * @brief 선 편집 요청을 오프라인 송신함에 보관 후 전송 시도
+     * @param message 전송할 메시지
+     * @param replacesLines 선 전체 교체 요청 여부 (이전 선 편집을 대체)
+     * @return 보관 성공 여부
+     */
+    bool queueLineEdit(const QJsonObject &message, bool replacesLines);
+    /** @brief 오프라인 송신함 항목을 순서대로 전송 */
+    void drainOutbox();
+    /** @brief 선 일괄 교체 항목을 구버전 서버용 선별 전송으로 풀어 보내기 */
+    bool sendOutboxLineSetFallback(const OutboxEntry &entry);
+    /**
+     * @brief 응답 없는 송신함 항목의 전달 확인 요청
+     * @param withPing 확인용 핑(60)을 바로 보낼지 여부
+     */
+    void requestOutboxConfirmation(bool withPing);
+    /** @brief 서버가 읽은 것으로 확인된 응답 없는 송신함 항목 전달 확인 */
+    void acknowledgeFlushedOutbox();
+    /** @brief 연결 해제 시 송신함 전송 상태 초기화 (항목은 다음 연결에서 다시 전송) */
+    void resetOutboxDelivery();
+    /**
+     * @brief TLS 핸드셰이크 시간 기록
+     * @param elapsedMs 핸드셰이크 시간(ms)
+     * @param resumed 세션 재사용 시도 여부
+     */
+    void recordHandshakeTime(qint64 elapsedMs, bool resumed);
     /** @brief 감지선 데이터 응답 처리 */
     void handleDetectionLinesFromServer(const QJsonObject &jsonObj);
     /** @brief 도로선 데이터 응답 처리 */
     void handleRoadLinesFromServer(const QJsonObject &jsonObj);
     /** @brief BBox 응답 처리 */
     void handleBBoxResponse(const QJsonObject &jsonObj);
+    /** @brief JSON BBox 객체 파싱 */
+    static BBox bboxFromJson(const QJsonObject &bboxObj);
+    /** @brief JSON BBox 부분 갱신 파싱 */
+    static BBoxPatch bboxPatchFromJson(const QJsonObject &patchObj);
+    /** @brief CBOR BBox 객체 파싱 */
+    static BBox bboxFromCbor(const QCborMap &bboxMap);
+    /** @brief CBOR BBox 부분 갱신 파싱 */
+    static BBoxPatch bboxPatchFromCbor(const QCborMap &patchMap);
+    /**
+     * @brief BBox 델타 프레임 적용 및 변경분 발신
+     * @param cameraId 카메라 ID
+     * @param added 새 트랙
+     * @param updated 부분 갱신
+     * @param removed 제거된 트랙 ID
+     * @param frameSeq 프레임 순번 (없으면 -1)
+     * @param timestamp 타임스탬프
+     */
+    void applyBBoxDelta(const QString &cameraId, const QList<BBox> &added, const QList<BBoxPatch> &updated,
+                        const QList<int> &removed, qint64 frameSeq, qint64 timestamp);
+    /** @brief BBox 변경분을 우편함에 넣고 필요할 때만 알림 */
+    void publishBBoxDelta(const QString &cameraId, const BBoxDelta &delta, qint64 timestamp);
+    /** @brief BBox 트랙 테이블 초기화 (화면 BBox 제거 변경분 발신) */
+    void resetBBoxTracks();
     /** @brief 모든 선 데이터 수신 완료 체크 및 시그널 발신 */
     void checkAndEmitAllLinesReceived();
+    /** @brief 수신 프레임 상태 초기화 */
+    void resetReceiveState();
 
     /** @brief 네트워크 소켓 */
     QSslSocket *m_socket;
@@ -275,24 +823,44 @@ private:
     QString m_host;
     /** @brief 포트 번호 */
     quint16 m_port;
-    /** @brief 연결 여부 */
-    bool m_isConnected;
-    /** @brief 수신 데이터 버퍼 */
-    QString m_receivedData;
-    /** @brief 자동 재연결 여부 */
-    bool m_autoReconnect;
-    /** @brief 비디오 뷰 포인터 */
-    VideoGraphicsView *m_videoView;
+    /** @brief 연결 여부 (GUI 스레드에서도 조회하므로 원자적) */
+    std::atomic<bool> m_isConnected;
+    /** @brief 수신 프레임 코덱 (연결별) */
+    FrameCodec m_frameCodec;
+    /** @brief 협상된 메시지 인코딩 */
+    WireFormat m_wireFormat;
+    /** @brief 서버의 선 일괄 교체(request_id 50) 지원 여부 */
+    bool m_lineSetSupported;
+    /** @brief 서버의 프레임 압축 지원 여부 */
+    bool m_frameCompressionSupported;
+    /** @brief 송신 압축 기준 크기(바이트), 0 이하면 사용 안 함 */
+    int m_compressionThresholdBytes;
+    /** @brief 압축 해제 허용 최대 크기(바이트) */
+    qint64 m_maxDecompressedBytes;
+    /** @brief 이미지 배치 진행 여부 */
+    bool m_imageBatchActive;
+    /** @brief 현재 배치에서 디코딩된 이미지 */
+    QList<ImageData> m_batchImages;
+    /** @brief 이미지 디코딩/저장 스레드 풀 (결과는 받은 순서대로 이 스레드에서 전달) */
+    ImageDecodePool *m_imageDecodePool;
+    /** @brief 디코딩 풀 포화로 소켓 읽기를 멈췄는지 여부 */
+    bool m_socketReadsPaused;
     /** @brief 연결 타임아웃(ms) */
     int m_connectionTimeoutMs;
     /** @brief 재연결 활성화 여부 */
     bool m_reconnectEnabled;
-    /** @brief 재연결 시도 횟수 */
+    /** @brief 연속 실패한 재연결 라운드 수 (백오프 지수) */
     int m_reconnectAttempts;
-    /** @brief 최대 재연결 시도 횟수 */
-    int m_maxReconnectAttempts;
-    /** @brief 재연결 지연(ms) */
-    int m_reconnectDelayMs;
+    /** @brief 재연결 기본 지연(ms) */
+    int m_reconnectBaseDelayMs;
+    /** @brief 재연결 최대 지연(ms) */
+    int m_reconnectMaxDelayMs;
+    /** @brief 페일오버 엔드포인트 리스트 */
+    QList<ServerEndpoint> m_endpoints;
+    /** @brief 현재 시도 중인 엔드포인트 인덱스 */
+    int m_endpointIndex;
+    /** @brief 연결 상태 (GUI 스레드에서도 조회하므로 원자적) */
+    std::atomic<ConnectionState> m_connectionState;
     /** @brief 저장된 도로선 리스트 */
     QList<RoadLineData> m_receivedRoadLines;
     /** @brief 저장된 감지선 리스트 */
@@ -301,6 +869,128 @@ private:
     bool m_roadLinesReceived;
     /** @brief 감지선 수신 여부 */
     bool m_detectionLinesReceived;
+    /** @brief 디코딩 통계 구간 타이머 */
+    QElapsedTimer m_decodeStatsTimer;
+    /** @brief 통계 구간 내 누적 디코딩 시간(ns) */
+    qint64 m_decodeTimeNs;
+    /** @brief 통계 구간 내 디코딩한 프레임 수 */
+    int m_decodedFrames;
+    /** @brief 통계 구간 내 최대 단일 디코딩 시간(ns) */
+    qint64 m_maxDecodeTimeNs;
+    /** @brief 마지막으로 부여한 상관 ID (요청 스레드에서 바로 부여하므로 원자적) */
+    std::atomic<quint32> m_nextSeq;
+    /** @brief 응답 대기 요청 테이블 (상관 ID → 요청) */
+    QHash<quint32, PendingRequest> m_pendingRequests;
+    /** @brief 대기 요청 마감 시간 확인 타이머 */
+    QTimer *m_requestDeadlineTimer;
+    /** @brief 기본 응답 마감 시간(ms) */
+    int m_defaultRequestTimeoutMs;
+    /** @brief 요청 ID별 지연 통계 */
+    QHash<int, LatencyStats> m_latencyStats;
+
+    /**
+     * @brief 수신 메시지 처리기 묶음
+     */
+    struct MessageHandler {
+        JsonMessageHandler json;    // JSON 처리기
+        CborMessageHandler cbor;    // CBOR 처리기 (없으면 JSON으로 변환)
+    };
+    /** @brief 응답 ID별 수신 메시지 처리기 테이블 */
+    QHash<int, MessageHandler> m_messageHandlers;
+    /** @brief 우선순위 송신 큐 */
+    OutboundQueue m_sendQueue;
+    /** @brief 송신 큐 비우기 예약 여부 (같은 이벤트 루프 회차의 프레임을 합침) */
+    bool m_flushScheduled;
+    /** @brief 소켓 송신 버퍼 상한 - 넘으면 큐에서 더 넘기지 않음 */
+    qint64 m_socketHighWaterBytes;
+    /** @brief 송신 큐 상한 - 넘으면 대용량 전송 거부 */
+    qint64 m_sendQueueLimitBytes;
+    /** @brief 한 번의 write()로 합칠 최대 바이트 수 */
+    qint64 m_maxBatchBytes;
+    /** @brief 송신 큐 대기 프레임 수 (다른 스레드 조회용) */
+    std::atomic<int> m_sendQueueDepth;
+    /** @brief 송신 큐 통계 구간 타이머 */
+    QElapsedTimer m_sendStatsTimer;
+
+    /**
+     * @brief 방향별 프레임 압축 통계
+     */
+    struct CompressionStats {
+        int frames = 0;         // 압축/해제 프레임 수
+        qint64 rawBytes = 0;    // 원본 바이트
+        qint64 wireBytes = 0;   // 전송 바이트
+        qint64 elapsedNs = 0;   // 압축/해제 CPU 시간(ns)
+    };
+    /** @brief 송신 압축 통계 */
+    CompressionStats m_txCompressionStats;
+    /** @brief 수신 압축 해제 통계 */
+    CompressionStats m_rxCompressionStats;
+    /** @brief 압축 통계 구간 타이머 */
+    QElapsedTimer m_compressionStatsTimer;
+
+    /** @brief 카메라별 BBox 트랙 테이블 */
+    QHash<QString, BBoxTrackTable> m_bboxTracks;
+    /** @brief 화면 전달용 최신 BBox 우편함 */
+    BBoxMailbox m_bboxMailbox;
+
+    /** @brief 하트비트 타이머 */
+    QTimer *m_heartbeatTimer;
+    /** @brief 핑 주기(ms), 0 이하면 사용 안 함 */
+    int m_heartbeatIntervalMs;
+    /** @brief 무응답 판정 시간(ms) */
+    int m_deadPeerTimeoutMs;
+    /** @brief 서버의 하트비트(60/61) 지원 여부 */
+    bool m_heartbeatSupported;
+    /** @brief 서버의 실시간 캡처 푸시(80/81, 210) 지원 여부 */
+    bool m_capturePushSupported;
+    /** @brief 실시간 캡처 구독 설정 여부 (재연결 시 다시 구독) */
+    bool m_captureSubscriptionEnabled;
+    /** @brief 마지막 수신 후 경과 시간 */
+    QElapsedTimer m_lastReceiveTimer;
+    /** @brief 마지막으로 보낸 핑 ID */
+    quint32 m_pingId;
+    /** @brief 응답 대기 중인 핑 여부 */
+    bool m_pingInFlight;
+    /** @brief 핑 전송 후 경과 시간 */
+    QElapsedTimer m_pingTimer;
+    /** @brief 최근 RTT 샘플(ms, 링 버퍼) */
+    QList<qint64> m_rttSamples;
+    /** @brief 다음 RTT 샘플 기록 위치 */
+    int m_rttSampleIndex;
+    /** @brief 마지막 RTT(ms) */
+    qint64 m_lastRttMs;
+    /** @brief 응답 없이 지나간 핑 수 */
+    int m_missedPongs;
+    /** @brief 엔드포인트별 TLS 세션 캐시 */
+    QHash<QString, CachedSession> m_sessionCache;
+    /** @brief TLS 세션 캐시 파일 경로 (비어 있으면 메모리만) */
+    QString m_sessionCacheFile;
+    /** @brief 오프라인 송신함 (네트워크 스레드 소유) */
+    OfflineOutbox m_outbox;
+    /** @brief 오프라인 송신함 사용 여부 (GUI 스레드에서도 조회하므로 원자적) */
+    std::atomic<bool> m_outboxEnabled;
+    /** @brief 이번 연결에서 송신함 전송 가능 여부 (기능 협상 완료 또는 대기 시간 경과) */
+    bool m_outboxReady;
+    /** @brief 응답(41)이 없는 구버전 서버용 협상 대기 타이머 */
+    QTimer *m_outboxHelloTimer;
+    /** @brief 응답을 기다리는 송신함 항목 키 */
+    QString m_outboxResponseKey;
+    /** @brief 전송했지만 서버가 읽었는지 확인되지 않은 응답 없는 송신함 항목 키 */
+    QStringList m_outboxFlushKeys;
+    /** @brief 응답을 받으면 m_outboxFlushKeys를 확인하는 첫 요청 번호 (0이면 없음) */
+    quint32 m_outboxConfirmSeq;
+    /** @brief 퐁을 받으면 m_outboxFlushKeys를 확인하는 핑 번호 (0이면 없음) */
+    quint32 m_outboxConfirmPingId;
+    /** @brief 연결 시도 시작 후 경과 시간 */
+    QElapsedTimer m_handshakeTimer;
+    /** @brief TCP 연결 수립까지 걸린 시간(ms) */
+    qint64 m_tcpConnectMs;
+    /** @brief 이번 시도에서 세션 티켓을 제시했는지 여부 */
+    bool m_sessionResumeAttempted;
+    /** @brief 전체 핸드셰이크 시간 통계 */
+    LatencyStats m_fullHandshakeStats;
+    /** @brief 세션 재사용 핸드셰이크 시간 통계 */
+    LatencyStats m_resumedHandshakeStats;
 };
 
 #endif // TCPCOMMUNICATOR_H
@@ -15,6 +15,7 @@ VideoGraphicsView::VideoGraphicsView(QWidget *parent)
     , m_drawing(false)
     , m_currentLineItem(nullptr)
     , m_currentCategory(LineCategory::ROAD_DEFINITION)
+    , m_bboxFilter{{ObjectClass::Vehicle, ObjectClass::Person, ObjectClass::Human}, 0.0, QRect()}
     , m_originalVideoSize(3840, 2160)  // 기본 원본 크기 설정
     , m_currentViewSize(960, 540)      // 현재 뷰 크기 설정
 {
@@ -425,88 +426,145 @@ void VideoGraphicsView::clearHighlight()
 }
 
 /**
- * @brief BBox 표시
- * @param bboxes BBox 리스트
+ * @brief BBox 변경분 적용
+ * @details object_id는 카메라마다 따로 매겨지므로 해당 카메라의 아이템에만 적용합니다.
+ * @param cameraId 카메라 ID
+ * @param delta 변경분
  * @param timestamp 타임스탬프
  */
-void VideoGraphicsView::setBBoxes(const QList<BBox> &bboxes, qint64 timestamp)
+void VideoGraphicsView::applyBBoxDelta(const QString &cameraId, const BBoxDelta &delta, qint64 timestamp)
 {
-    // 기존 BBox 아이템들 제거
-    clearBBoxes();
+    Q_UNUSED(timestamp);
 
-    // 스케일 계산 (원본 해상도 → 뷰어 해상도)
-    double scaleX = static_cast<double>(m_currentViewSize.width()) / m_originalVideoSize.width();
-    double scaleY = static_cast<double>(m_currentViewSize.height()) / m_originalVideoSize.height();
-
-    for (const BBox &bbox : bboxes) {
-        // Vehicle과 Human(Person) 타입만 필터링
-        QString lowerType = bbox.type.toLower();
-        if (lowerType != "vehical" && lowerType != "person" && lowerType != "human") {
-            continue; // 다른 타입은 건너뛰기
+    QHash<int, BBoxItem> &items = m_bboxItems[cameraId];
+    if (delta.reset) {
+        for (const BBoxItem &item : std::as_const(items)) {
+            deleteBBoxItem(item);
         }
-
-        // 좌표 스케일 변환
-        QRectF scaledRect(
-            bbox.rect.x() * scaleX,
-            bbox.rect.y() * scaleY,
-            bbox.rect.width() * scaleX,
-            bbox.rect.height() * scaleY
-            );
-
-        // 사각형 아이템 생성
-        QGraphicsRectItem* rectItem = new QGraphicsRectItem(scaledRect);
-        QPen pen(Qt::red, 2);
-        rectItem->setPen(pen);
-        rectItem->setBrush(Qt::NoBrush);
-        rectItem->setData(0, "bbox"); // 식별을 위한 데이터 설정
-        m_scene->addItem(rectItem);
-        m_bboxRectItems.append(rectItem);
-
-        // 텍스트 아이템 생성 (타입과 신뢰도 표시 - 백분율로 표시)
-        QString labelText = QString("%1 (%2%)").arg(bbox.type).arg(static_cast<int>(bbox.confidence * 100));
-        QGraphicsTextItem* textItem = new QGraphicsTextItem(labelText);
-
-        // 텍스트 스타일 설정
-        QFont font = textItem->font();
-        font.setPointSize(10);
-        font.setBold(true);
-        textItem->setFont(font);
-        textItem->setDefaultTextColor(Qt::red);
-
-        // 텍스트 위치 설정 (바운딩 박스 위쪽)
-        textItem->setPos(scaledRect.x(), scaledRect.y() - 20);
-        textItem->setData(0, "bbox_text"); // 식별을 위한 데이터 설정
-        m_scene->addItem(textItem);
-        m_bboxTextItems.append(textItem);
+        items.clear();
+    }
+    for (int id : delta.removed) {
+        removeBBoxItem(items, id);
+    }
+    for (const BBox &bbox : delta.upserted) {
+        upsertBBoxItem(items, bbox);
+    }
+    if (items.isEmpty()) {
+        m_bboxItems.remove(cameraId);
     }
-
-    qDebug() << QString("[VideoView] BBox 시각화 완료 - %1개 객체, 타임스탬프: %2").arg(bboxes.size()).arg(timestamp);
 }
 
 /**
- * @brief BBox 모두 제거
+ * @brief BBox 모두 제거 (모든 카메라)
  */
 void VideoGraphicsView::clearBBoxes()
 {
-    // 기존 BBox 사각형 아이템들 제거
-    for (QGraphicsRectItem* item : m_bboxRectItems) {
-        if (item) {
-            m_scene->removeItem(item);
-            delete item;
+    // 기존 BBox 사각형/텍스트 아이템들 제거
+    for (const QHash<int, BBoxItem> &items : std::as_const(m_bboxItems)) {
+        for (const BBoxItem &item : items) {
+            deleteBBoxItem(item);
         }
     }
-    m_bboxRectItems.clear();
+    m_bboxItems.clear();
 
-    // 기존 BBox 텍스트 아이템들 제거
-    for (QGraphicsTextItem* item : m_bboxTextItems) {
-        if (item) {
-            m_scene->removeItem(item);
-            delete item;
+    qDebug() << "[VideoView] BBox 아이템들 제거 완료";
+}
+
+/**
+ * @brief BBox 아이템 추가 또는 제자리 갱신
+ * @param items 카메라의 BBox 아이템
+ * @param bbox BBox (원본 해상도 좌표)
+ */
+void VideoGraphicsView::upsertBBoxItem(QHash<int, BBoxItem> &items, const BBox &bbox)
+{
+    // 구독 필터 (클래스/신뢰도/관심 영역) - 서버가 필터를 지원하면 여기서 걸러지는 BBox는 없음
+    if (!m_bboxFilter.accepts(bbox)) {
+        // 타입/신뢰도/위치가 바뀌어 대상에서 빠진 객체도 제거
+        removeBBoxItem(items, bbox.object_id);
+        return;
+    }
+
+    // 스케일 계산 (원본 해상도 → 뷰어 해상도)
+    double scaleX = static_cast<double>(m_currentViewSize.width()) / m_originalVideoSize.width();
+    double scaleY = static_cast<double>(m_currentViewSize.height()) / m_originalVideoSize.height();
+
+    // 좌표 스케일 변환
+    QRectF scaledRect(
+        bbox.rect.x() * scaleX,
+        bbox.rect.y() * scaleY,
+        bbox.rect.width() * scaleX,
+        bbox.rect.height() * scaleY
+        );
+
+    // 신뢰도는 백분율로 표시
+    const int confidencePercent = static_cast<int>(bbox.confidence * 100);
+    auto labelText = [&bbox, confidencePercent]() {
+        return QString("%1 (%2%)").arg(ObjectClassTable::name(bbox.type)).arg(confidencePercent);
+    };
+
+    auto it = items.find(bbox.object_id);
+    if (it != items.end()) {
+        // 기존 아이템 이동 (텍스트는 타입/신뢰도가 바뀐 경우에만 다시 만듦)
+        it->rectItem->setRect(scaledRect);
+        it->textItem->setPos(scaledRect.x(), scaledRect.y() - 20);
+        if (it->type != bbox.type || it->confidencePercent != confidencePercent) {
+            it->textItem->setPlainText(labelText());
+            it->type = bbox.type;
+            it->confidencePercent = confidencePercent;
         }
+        return;
     }
-    m_bboxTextItems.clear();
 
-    qDebug() << "[VideoView] BBox 아이템들 제거 완료";
+    // 사각형 아이템 생성
+    QGraphicsRectItem* rectItem = new QGraphicsRectItem(scaledRect);
+    QPen pen(Qt::red, 2);
+    rectItem->setPen(pen);
+    rectItem->setBrush(Qt::NoBrush);
+    rectItem->setData(0, "bbox"); // 식별을 위한 데이터 설정
+    m_scene->addItem(rectItem);
+
+    QGraphicsTextItem* textItem = new QGraphicsTextItem(labelText());
+
+    // 텍스트 스타일 설정
+    QFont font = textItem->font();
+    font.setPointSize(10);
+    font.setBold(true);
+    textItem->setFont(font);
+    textItem->setDefaultTextColor(Qt::red);
+
+    // 텍스트 위치 설정 (바운딩 박스 위쪽)
+    textItem->setPos(scaledRect.x(), scaledRect.y() - 20);
+    textItem->setData(0, "bbox_text"); // 식별을 위한 데이터 설정
+    m_scene->addItem(textItem);
+
+    items.insert(bbox.object_id, BBoxItem{rectItem, textItem, bbox.type, confidencePercent});
+}
+
+/**
+ * @brief BBox 아이템 제거
+ * @param items 카메라의 BBox 아이템
+ * @param objectId 객체 ID
+ */
+void VideoGraphicsView::removeBBoxItem(QHash<int, BBoxItem> &items, int objectId)
+{
+    auto it = items.find(objectId);
+    if (it == items.end()) {
+        return;
+    }
+    deleteBBoxItem(*it);
+    items.erase(it);
+}
+
+/**
+ * @brief 아이템의 사각형/라벨을 장면에서 제거
+ * @param item BBox 아이템
+ */
+void VideoGraphicsView::deleteBBoxItem(const BBoxItem &item)
+{
+    m_scene->removeItem(item.rectItem);
+    delete item.rectItem;
+    m_scene->removeItem(item.textItem);
+    delete item.textItem;
 }
 
 /**
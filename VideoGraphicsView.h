@@ -11,6 +11,7 @@
 #include <QGraphicsEllipseItem>
 #include <QGraphicsRectItem>
 #include <QGraphicsTextItem>
+#include <QHash>
 
 /**
  * @brief 선 카테고리 열거형
@@ -115,13 +116,16 @@ public:
      */
     void drawImmediateTestLines();
     /**
-     * @brief BBox 표시
-     * @param bboxes BBox 리스트
+     * @brief BBox 변경분 적용
+     * @details 바뀐 객체의 아이템만 제자리에서 이동/갱신합니다. object_id는 카메라마다 따로
+     *          매겨지므로 아이템은 카메라별로 관리하며, 변경분은 해당 카메라 아이템에만 적용됩니다.
+     * @param cameraId 카메라 ID
+     * @param delta 변경분
      * @param timestamp 타임스탬프
      */
-    void setBBoxes(const QList<BBox> &bboxes, qint64 timestamp);
+    void applyBBoxDelta(const QString &cameraId, const BBoxDelta &delta, qint64 timestamp);
     /**
-     * @brief BBox 모두 제거
+     * @brief BBox 모두 제거 (모든 카메라)
      */
     void clearBBoxes();
     /**
@@ -129,6 +133,12 @@ public:
      * @param size QSize
      */
     void setOriginalVideoSize(const QSize &size) { m_originalVideoSize = size; }
+    /**
+     * @brief BBox 표시 필터 설정
+     * @details 이미 표시된 BBox에는 다음 갱신부터 적용됩니다.
+     * @param filter 필터 (서버 구독과 같은 조건)
+     */
+    void setBBoxFilter(const BBoxFilter &filter) { m_bboxFilter = filter; }
 
 signals:
     /** @brief 선 그려짐 시그널 */
@@ -154,6 +164,22 @@ protected:
     void mouseReleaseEvent(QMouseEvent *event) override;
 
 private:
+    /**
+     * @brief 화면의 BBox 아이템 묶음
+     */
+    struct BBoxItem {
+        QGraphicsRectItem *rectItem;    // 사각형 아이템
+        QGraphicsTextItem *textItem;    // 라벨 아이템
+        ObjectClass type;               // 라벨에 표시 중인 타입
+        int confidencePercent;          // 라벨에 표시 중인 신뢰도(%)
+    };
+
+    /** @brief BBox 아이템 추가 또는 제자리 갱신 */
+    void upsertBBoxItem(QHash<int, BBoxItem> &items, const BBox &bbox);
+    /** @brief BBox 아이템 제거 */
+    void removeBBoxItem(QHash<int, BBoxItem> &items, int objectId);
+    /** @brief 아이템의 사각형/라벨을 장면에서 제거 */
+    void deleteBBoxItem(const BBoxItem &item);
     /** @brief 도로선 하이라이트 */
     void highlightRoadLine(int lineIndex);
     /** @brief 좌표 하이라이트 */
@@ -182,10 +208,10 @@ private:
     LineCategory m_currentCategory;
     /** @brief 카테고리별 선 리스트 */
     QList<CategorizedLine> m_categorizedLines;
-    /** @brief BBox 사각형 아이템 리스트 */
-    QList<QGraphicsRectItem*> m_bboxRectItems;
-    /** @brief BBox 텍스트 아이템 리스트 */
-    QList<QGraphicsTextItem*> m_bboxTextItems;
+    /** @brief 카메라별, object_id별 BBox 아이템 */
+    QHash<QString, QHash<int, BBoxItem>> m_bboxItems;
+    /** @brief BBox 표시 필터 */
+    BBoxFilter m_bboxFilter;
     /** @brief 원본 비디오 크기 */
     QSize m_originalVideoSize;
     /** @brief 현재 뷰 크기 */
@@ -1,6 +1,7 @@
 #include "LoginWindow.h"
 #include "MainWindow.h"
 #include "TcpCommunicator.h"
+#include "ConnectionManager.h"
 #include "CustomMessageBox.h"
 
 #include <QApplication>
@@ -81,23 +82,28 @@ int main(int argc, char *argv[])
     darkPalette.setColor(QPalette::HighlightedText, Qt::black);
     app.setPalette(darkPalette);
 
-    // 공유 TcpCommunicator 생성
-    TcpCommunicator *sharedTcpCommunicator = new TcpCommunicator();
+    // 사이트(백엔드)별 TcpCommunicator를 각자의 네트워크 스레드에서 관리
+    // (TLS 복호화/프레이밍/파싱/이미지 저장이 영상 렌더링과 GUI 스레드, 다른 사이트를 다투지 않도록)
+    ConnectionManager connectionManager;
+
     // 로그인 창 생성 및 표시
     LoginWindow loginWindow;
-    // LoginWindow에 공유 TcpCommunicator 설정
-    loginWindow.setTcpCommunicator(sharedTcpCommunicator);
+    // .env의 사이트 구성으로 연결을 만들고 기본 사이트 통신기를 로그인에 사용
+    loginWindow.setConnectionManager(&connectionManager);
 
     // 로그인 창 표시
+    int exitCode = 0;
     if (loginWindow.exec() == QDialog::Accepted) {
         qDebug() << "로그인 다이얼로그가 성공적으로 완료되었습니다.";
         MainWindow *mainWindow = new MainWindow();
-        mainWindow->setTcpCommunicator(sharedTcpCommunicator);
+        // 카메라가 속한 사이트 통신기로 요청을 보내고 전체 사이트 연결 상태를 표시
+        mainWindow->setConnectionManager(&connectionManager);
         mainWindow->show();
-        return app.exec();
+        exitCode = app.exec();
     } else {
         qDebug() << "로그인이 취소되었습니다.";
-        delete sharedTcpCommunicator; // 로그인 실패 시 정리
-        return 0;
     }
+
+    // 사이트별 네트워크 스레드는 connectionManager 소멸 시 종료 (finished 시그널로 TcpCommunicator 정리)
+    return exitCode;
 }
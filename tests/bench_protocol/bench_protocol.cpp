@@ -0,0 +1,745 @@
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QRandomGenerator>
+#include <QSslSocket>
+#include <QtEndian>
+#include <QtTest>
+#include <cstdio>
+
+#include <functional>
+
+#include "Base64Decoder.h"
+#include "ChunkedRingBuffer.h"
+#include "TcpCommunicator.h"
+
+/**
+ * @brief 프로토콜 처리 벤치마크
+ * @details 수신 버퍼 방식별 프레이밍 비용을 잽니다. 행 이름에 프레임 크기와 개수를 넣어
+ *          전체 바이트 수 대비 시간이 선형인지 비교할 수 있게 합니다.
+ *          디스패치 벤치마크는 처리기 표 + 필드 설명 디코더와 이전 switch + operator[] 방식을 비교합니다.
+ *          base64 벤치마크는 원시 UTF-8 바이트를 바로 디코딩하는 Base64Decoder와 이전 QString 경유 경로를
+ *          1~5MB 이미지 본문으로 비교합니다.
+ *          압축 벤치마크는 CCTV_TRAFFIC_FILE 환경 변수에 수신 스트림 녹화(길이 프리픽스 프레임을
+ *          받은 그대로 이어 붙인 파일)를 지정하면 그 트래픽을, 없으면 서버 양식의 대표 메시지를 씁니다.
+ *          TLS 핸드셰이크 벤치마크는 CCTV_TLS_BENCH_HOST=host:port 서버에 세션 티켓 없이 연결할 때와
+ *          캐시한 티켓을 제시할 때를 비교합니다 (환경 변수가 없으면 건너뜀).
+ *          반복 측정: bench_protocol -iterations 20 <함수 이름>
+ */
+class BenchProtocol : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    void framingChunkedRingBuffer_data();
+    void framingChunkedRingBuffer();
+    void framingLegacyRemove_data();
+    void framingLegacyRemove();
+
+    void compressionSend_data();
+    void compressionSend();
+    void compressionReceive_data();
+    void compressionReceive();
+
+    void dispatchHandlerTable();
+    void dispatchSwitch();
+    void decodeBBoxFieldDescriptors();
+    void decodeBBoxOperatorIndex();
+    void decodeRoadLineFieldDescriptors();
+    void decodeRoadLineOperatorIndex();
+
+    void base64Decoder_data();
+    void base64Decoder();
+    void base64DecoderLenient_data();
+    void base64DecoderLenient();
+    void base64QStringChain_data();
+    void base64QStringChain();
+
+    void tlsHandshake_data();
+    void tlsHandshake();
+
+private:
+    /** @brief 길이 프리픽스 프레임 N개를 소켓 크기 조각으로 나눈 스트림 */
+    static QList<QByteArray> framedChunks(int frameBytes, int frameCount, int chunkBytes);
+    /** @brief 프레임 크기/개수 행 추가 */
+    static void addFramingRows();
+    /** @brief 압축 기준 크기 행 추가 */
+    static void addCompressionRows();
+    /** @brief 압축 측정용 페이로드 (녹화 트래픽 또는 대표 메시지) */
+    static const QList<QByteArray> &trafficPayloads();
+    /** @brief 녹화 파일에서 프레임 페이로드 읽기 (압축 프레임은 해제) */
+    static QList<QByteArray> loadRecordedTraffic(const QString &path);
+    /** @brief 서버 양식의 대표 메시지 생성 */
+    static QList<QByteArray> sampleTraffic();
+    /** @brief 디스패치 측정용 메시지 (응답 ID가 섞인 순서) */
+    static QList<QJsonObject> dispatchMessages();
+    /** @brief BBox 객체 목록 */
+    static QJsonArray bboxObjects(int count);
+    /** @brief 도로 기준선 객체 목록 */
+    static QJsonArray roadLineObjects(int count);
+    /** @brief base64 본문 크기 행 추가 (data URL 접두사 포함 JSON 이미지 원소) */
+    static void addBase64Rows();
+    /** @brief 인코딩 크기 기준 data URL 이미지 원소 생성 */
+    static QByteArray base64ImageElement(int encodedBytes, bool lineWrapped);
+    /** @brief 전체 핸드셰이크로 연결해 서버가 보낸 세션 티켓 받기 */
+    static QByteArray fetchSessionTicket(const QString &host, quint16 port, const QSslConfiguration &configuration);
+};
+
+/**
+ * @brief 측정 중 qDebug 로그 끄기
+ */
+void BenchProtocol::initTestCase()
+{
+    qInstallMessageHandler([](QtMsgType type, const QMessageLogContext &, const QString &message) {
+        if (type != QtDebugMsg) {
+            fprintf(stderr, "%s\n", qPrintable(message));
+        }
+    });
+}
+
+QList<QByteArray> BenchProtocol::framedChunks(int frameBytes, int frameCount, int chunkBytes)
+{
+    QByteArray frame(4 + frameBytes, 'x');
+    qToBigEndian<quint32>(static_cast<quint32>(frameBytes), frame.data());
+
+    QByteArray stream;
+    stream.reserve(static_cast<qsizetype>(frame.size()) * frameCount);
+    for (int i = 0; i < frameCount; ++i) {
+        stream += frame;
+    }
+
+    QList<QByteArray> chunks;
+    for (qsizetype offset = 0; offset < stream.size(); offset += chunkBytes) {
+        chunks.append(stream.mid(offset, chunkBytes));
+    }
+    return chunks;
+}
+
+void BenchProtocol::addFramingRows()
+{
+    QTest::addColumn<int>("frameBytes");
+    QTest::addColumn<int>("frameCount");
+
+    // 전체 크기를 고정하고 프레임 크기를 키움 (선형이면 시간이 거의 같아야 함)
+    QTest::newRow("64MB as 4096 x 16KB") << 16 * 1024 << 4096;
+    QTest::newRow("64MB as 256 x 256KB") << 256 * 1024 << 256;
+    QTest::newRow("64MB as 16 x 4MB") << 4 * 1024 * 1024 << 16;
+    QTest::newRow("64MB as 4 x 16MB") << 16 * 1024 * 1024 << 4;
+    // 프레임 크기를 고정하고 개수를 키움 (시간이 개수에 비례해야 함)
+    QTest::newRow("4 x 1MB") << 1024 * 1024 << 4;
+    QTest::newRow("16 x 1MB") << 1024 * 1024 << 16;
+    QTest::newRow("64 x 1MB") << 1024 * 1024 << 64;
+}
+
+void BenchProtocol::framingChunkedRingBuffer_data()
+{
+    addFramingRows();
+}
+
+/**
+ * @brief ChunkedRingBuffer 프레이밍 (FrameCodec 일반 경로와 같은 읽기 방식)
+ */
+void BenchProtocol::framingChunkedRingBuffer()
+{
+    QFETCH(int, frameBytes);
+    QFETCH(int, frameCount);
+    const QList<QByteArray> chunks = framedChunks(frameBytes, frameCount, 64 * 1024);
+
+    QBENCHMARK {
+        ChunkedRingBuffer buffer;
+        qint64 expected = -1;
+        int frames = 0;
+        for (const QByteArray &chunk : chunks) {
+            buffer.append(chunk);
+            while (true) {
+                if (expected < 0) {
+                    if (buffer.size() < 4) {
+                        break;
+                    }
+                    uchar header[4];
+                    buffer.read(reinterpret_cast<char *>(header), 4);
+                    expected = qFromBigEndian<quint32>(header);
+                }
+                if (buffer.size() < expected) {
+                    break;
+                }
+                const QByteArray payload = buffer.read(expected);
+                Q_UNUSED(payload);
+                expected = -1;
+                ++frames;
+            }
+        }
+        QCOMPARE(frames, frameCount);
+    }
+}
+
+void BenchProtocol::framingLegacyRemove_data()
+{
+    addFramingRows();
+}
+
+/**
+ * @brief 이전 방식 프레이밍 (단일 QByteArray에 누적 후 remove(0, n)로 앞부분 당김)
+ */
+void BenchProtocol::framingLegacyRemove()
+{
+    QFETCH(int, frameBytes);
+    QFETCH(int, frameCount);
+    const QList<QByteArray> chunks = framedChunks(frameBytes, frameCount, 64 * 1024);
+
+    QBENCHMARK {
+        QByteArray buffer;
+        qint64 expected = -1;
+        int frames = 0;
+        for (const QByteArray &chunk : chunks) {
+            buffer.append(chunk);
+            while (true) {
+                if (expected < 0) {
+                    if (buffer.size() < 4) {
+                        break;
+                    }
+                    expected = qFromBigEndian<quint32>(buffer.constData());
+                    buffer.remove(0, 4);
+                }
+                if (buffer.size() < expected) {
+                    break;
+                }
+                const QByteArray payload = buffer.left(expected);
+                Q_UNUSED(payload);
+                buffer.remove(0, expected);
+                expected = -1;
+                ++frames;
+            }
+        }
+        QCOMPARE(frames, frameCount);
+    }
+}
+
+void BenchProtocol::addCompressionRows()
+{
+    QTest::addColumn<int>("thresholdBytes");
+
+    QTest::newRow("threshold 0 (all frames)") << 1;
+    QTest::newRow("threshold 1KB") << 1024;
+    QTest::newRow("threshold 4KB (default)") << 4096;
+    QTest::newRow("threshold 16KB") << 16 * 1024;
+}
+
+QList<QByteArray> BenchProtocol::loadRecordedTraffic(const QString &path)
+{
+    QList<QByteArray> payloads;
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "[Bench] 트래픽 파일을 열 수 없음:" << path;
+        return payloads;
+    }
+
+    const QByteArray stream = file.readAll();
+    qsizetype offset = 0;
+    while (offset + 4 <= stream.size()) {
+        const quint32 lengthField = qFromBigEndian<quint32>(stream.constData() + offset);
+        const qsizetype length = lengthField & 0x7FFFFFFFu;
+        if (offset + 4 + length > stream.size()) {
+            break;
+        }
+        QByteArray payload = stream.mid(offset + 4, length);
+        if (lengthField & 0x80000000u) {
+            payload = qUncompress(payload);
+        }
+        if (!payload.isEmpty()) {
+            payloads.append(payload);
+        }
+        offset += 4 + length;
+    }
+    return payloads;
+}
+
+QList<QByteArray> BenchProtocol::sampleTraffic()
+{
+    QList<QByteArray> payloads;
+
+    // 탐지선/기준선 목록 응답 (request_id 12, 16)
+    QJsonArray detectionLines;
+    QJsonArray roadLines;
+    for (int i = 0; i < 8; ++i) {
+        detectionLines.append(QJsonObject{{"index", i}, {"x1", 100 + i}, {"y1", 200}, {"x2", 300 + i}, {"y2", 400},
+                                          {"name", QString("line_%1").arg(i)}, {"mode", "BothDirections"},
+                                          {"leftMatrixNum", i % 4 + 1}, {"rightMatrixNum", (i + 1) % 4 + 1}});
+        roadLines.append(QJsonObject{{"index", i}, {"matrixNum1", i % 4 + 1}, {"x1", 10 * i}, {"y1", 20},
+                                     {"matrixNum2", (i + 2) % 4 + 1}, {"x2", 10 * i + 500}, {"y2", 700}});
+    }
+    payloads.append(QJsonDocument(QJsonObject{{"request_id", 12}, {"data", detectionLines}}).toJson(QJsonDocument::Compact));
+    payloads.append(QJsonDocument(QJsonObject{{"request_id", 16}, {"data", roadLines}}).toJson(QJsonDocument::Compact));
+
+    // 이미지 메타데이터 페이지 (본문 제외, 썸네일은 별도 요청)
+    QJsonArray images;
+    for (int i = 0; i < 200; ++i) {
+        images.append(QJsonObject{{"image_id", QString("cam01-20250101-%1").arg(i, 6, 10, QChar('0'))},
+                                  {"timestamp", QString("2025-01-01T12:%1:%2").arg(i / 60, 2, 10, QChar('0'))
+                                                                             .arg(i % 60, 2, 10, QChar('0'))},
+                                  {"detection_type", i % 3 ? "vehicle" : "person"},
+                                  {"direction", i % 2 ? "left" : "right"}});
+    }
+    payloads.append(QJsonDocument(QJsonObject{{"request_id", 10}, {"seq", 1}, {"next_cursor", "c200"},
+                                              {"data", images}}).toJson(QJsonDocument::Compact));
+
+    // BBox 전체 프레임 (작은 메시지가 대부분)
+    for (int frame = 0; frame < 100; ++frame) {
+        QJsonArray bboxes;
+        for (int i = 0; i < 6; ++i) {
+            bboxes.append(QJsonObject{{"id", i}, {"type", i % 2 ? "car" : "person"}, {"confidence", 0.5 + i * 0.05},
+                                      {"x", 100 + frame + i * 50}, {"y", 200 + i * 10}, {"width", 80}, {"height", 160}});
+        }
+        payloads.append(QJsonDocument(QJsonObject{{"request_id", 200}, {"timestamp", 1735700000000LL + frame * 33},
+                                                  {"bboxes", bboxes}}).toJson(QJsonDocument::Compact));
+    }
+    return payloads;
+}
+
+const QList<QByteArray> &BenchProtocol::trafficPayloads()
+{
+    static const QList<QByteArray> payloads = []() {
+        const QString path = qEnvironmentVariable("CCTV_TRAFFIC_FILE");
+        QList<QByteArray> recorded;
+        if (!path.isEmpty()) {
+            recorded = loadRecordedTraffic(path);
+            qInfo("[Bench] 녹화 트래픽 %lld 프레임 사용: %s", static_cast<long long>(recorded.size()), qPrintable(path));
+        }
+        return recorded.isEmpty() ? sampleTraffic() : recorded;
+    }();
+    return payloads;
+}
+
+void BenchProtocol::compressionSend_data()
+{
+    addCompressionRows();
+}
+
+/**
+ * @brief 송신 압축 비용과 절감량 (TcpCommunicator::writeMessage와 같은 규칙: 기준 이상, 작아질 때만, 레벨 6)
+ */
+void BenchProtocol::compressionSend()
+{
+    QFETCH(int, thresholdBytes);
+    const QList<QByteArray> &payloads = trafficPayloads();
+
+    qint64 rawBytes = 0;
+    qint64 wireBytes = 0;
+    int compressedFrames = 0;
+    QBENCHMARK {
+        rawBytes = 0;
+        wireBytes = 0;
+        compressedFrames = 0;
+        for (const QByteArray &payload : payloads) {
+            rawBytes += 4 + payload.size();
+            if (payload.size() >= thresholdBytes) {
+                const QByteArray compressed = qCompress(payload, 6);
+                if (compressed.size() < payload.size()) {
+                    wireBytes += 4 + compressed.size();
+                    ++compressedFrames;
+                    continue;
+                }
+            }
+            wireBytes += 4 + payload.size();
+        }
+    }
+
+    qInfo("[Bench] %s: %lld -> %lld bytes (%.1f%%), %d/%lld frames compressed",
+          QTest::currentDataTag(), static_cast<long long>(rawBytes), static_cast<long long>(wireBytes),
+          rawBytes > 0 ? 100.0 * wireBytes / rawBytes : 0.0, compressedFrames,
+          static_cast<long long>(payloads.size()));
+}
+
+void BenchProtocol::compressionReceive_data()
+{
+    addCompressionRows();
+}
+
+/**
+ * @brief 수신 측 압축 해제 비용 (송신 측과 같은 규칙으로 압축된 프레임만 해제)
+ */
+void BenchProtocol::compressionReceive()
+{
+    QFETCH(int, thresholdBytes);
+
+    QList<QByteArray> compressedPayloads;
+    for (const QByteArray &payload : trafficPayloads()) {
+        if (payload.size() >= thresholdBytes) {
+            const QByteArray compressed = qCompress(payload, 6);
+            if (compressed.size() < payload.size()) {
+                compressedPayloads.append(compressed);
+            }
+        }
+    }
+
+    QBENCHMARK {
+        qint64 bytes = 0;
+        for (const QByteArray &payload : compressedPayloads) {
+            bytes += qUncompress(payload).size();
+        }
+        QVERIFY(compressedPayloads.isEmpty() || bytes > 0);
+    }
+}
+
+QList<QJsonObject> BenchProtocol::dispatchMessages()
+{
+    // BBox가 대부분이고 제어 응답이 드물게 섞인 실제 수신 비율을 흉내 냄
+    const int ids[] = {200, 200, 200, 61, 200, 200, 12, 200, 200, 16, 200, 41, 200, 51, 200, 999};
+    QList<QJsonObject> messages;
+    for (int i = 0; i < 1000; ++i) {
+        messages.append(QJsonObject{{"request_id", ids[i % 16]}, {"seq", i}});
+    }
+    return messages;
+}
+
+QJsonArray BenchProtocol::bboxObjects(int count)
+{
+    QJsonArray array;
+    for (int i = 0; i < count; ++i) {
+        array.append(QJsonObject{{"id", i}, {"type", i % 2 ? "Vehicle" : "Person"}, {"confidence", 0.9},
+                                 {"x", 10 * i}, {"y", 20 * i}, {"width", 80}, {"height", 160}});
+    }
+    return array;
+}
+
+QJsonArray BenchProtocol::roadLineObjects(int count)
+{
+    QJsonArray array;
+    for (int i = 0; i < count; ++i) {
+        array.append(QJsonObject{{"index", i}, {"matrixNum1", i % 4 + 1}, {"x1", 10 * i}, {"y1", 20},
+                                 {"matrixNum2", (i + 2) % 4 + 1}, {"x2", 10 * i + 500}, {"y2", 700}});
+    }
+    return array;
+}
+
+/**
+ * @brief 처리기 표 디스패치 (TcpCommunicator::m_messageHandlers와 같은 QHash + std::function)
+ */
+void BenchProtocol::dispatchHandlerTable()
+{
+    const QList<QJsonObject> messages = dispatchMessages();
+    qint64 handled = 0;
+    QHash<int, std::function<void(const QJsonObject &)>> handlers;
+    for (int id : {12, 16, 41, 51, 61, 200}) {
+        handlers.insert(id, [&handled](const QJsonObject &message) { handled += message["seq"].toInt(); });
+    }
+
+    QBENCHMARK {
+        for (const QJsonObject &message : messages) {
+            int responseId = message["request_id"].toInt();
+            if (responseId == 0) {
+                responseId = message["response_id"].toInt();
+            }
+            const auto it = handlers.constFind(responseId);
+            if (it != handlers.constEnd()) {
+                it.value()(message);
+            }
+        }
+    }
+    QVERIFY(handled > 0);
+}
+
+/**
+ * @brief 이전 switch 디스패치
+ */
+void BenchProtocol::dispatchSwitch()
+{
+    const QList<QJsonObject> messages = dispatchMessages();
+    qint64 handled = 0;
+    const auto handle = [&handled](const QJsonObject &message) { handled += message["seq"].toInt(); };
+
+    QBENCHMARK {
+        for (const QJsonObject &message : messages) {
+            int requestId = message["request_id"].toInt();
+            if (requestId == 0) {
+                requestId = message["response_id"].toInt();
+            }
+            switch (requestId) {
+            case 12:
+            case 16:
+            case 41:
+            case 51:
+            case 61:
+            case 200:
+                handle(message);
+                break;
+            default:
+                break;
+            }
+        }
+    }
+    QVERIFY(handled > 0);
+}
+
+/**
+ * @brief 필드 설명 템플릿 디코딩 (decodeJsonFields<BBox>)
+ */
+void BenchProtocol::decodeBBoxFieldDescriptors()
+{
+    const QJsonArray array = bboxObjects(1000);
+    QList<BBox> bboxes;
+    bboxes.reserve(array.size());
+
+    QBENCHMARK {
+        bboxes.clear();
+        for (const QJsonValue &value : array) {
+            bboxes.append(decodeJsonFields<BBox>(value.toObject()));
+        }
+    }
+    QCOMPARE(bboxes.size(), array.size());
+    QCOMPARE(bboxes.last().rect.width(), 80);
+}
+
+/**
+ * @brief 이전 operator[] 디코딩 (키마다 임시 QJsonValue 생성)
+ */
+void BenchProtocol::decodeBBoxOperatorIndex()
+{
+    const QJsonArray array = bboxObjects(1000);
+    QList<BBox> bboxes;
+    bboxes.reserve(array.size());
+
+    QBENCHMARK {
+        bboxes.clear();
+        for (const QJsonValue &value : array) {
+            const QJsonObject bboxObj = value.toObject();
+            BBox bbox;
+            bbox.object_id = bboxObj["id"].toInt();
+            bbox.type = ObjectClassTable::intern(bboxObj["type"].toString());
+            bbox.confidence = bboxObj["confidence"].toDouble();
+            bbox.rect = QRect(bboxObj["x"].toInt(), bboxObj["y"].toInt(),
+                              bboxObj["width"].toInt(), bboxObj["height"].toInt());
+            bboxes.append(bbox);
+        }
+    }
+    QCOMPARE(bboxes.size(), array.size());
+    QCOMPARE(bboxes.last().rect.width(), 80);
+}
+
+/**
+ * @brief 필드 설명 템플릿 디코딩 (decodeJsonFields<RoadLineData>)
+ */
+void BenchProtocol::decodeRoadLineFieldDescriptors()
+{
+    const QJsonArray array = roadLineObjects(1000);
+    QList<RoadLineData> lines;
+    lines.reserve(array.size());
+
+    QBENCHMARK {
+        lines.clear();
+        for (const QJsonValue &value : array) {
+            lines.append(decodeJsonFields<RoadLineData>(value.toObject()));
+        }
+    }
+    QCOMPARE(lines.size(), array.size());
+    QCOMPARE(lines.last().y2, 700);
+}
+
+/**
+ * @brief 이전 operator[] 디코딩
+ */
+void BenchProtocol::decodeRoadLineOperatorIndex()
+{
+    const QJsonArray array = roadLineObjects(1000);
+    QList<RoadLineData> lines;
+    lines.reserve(array.size());
+
+    QBENCHMARK {
+        lines.clear();
+        for (const QJsonValue &value : array) {
+            const QJsonObject lineObj = value.toObject();
+            RoadLineData line;
+            line.index = lineObj["index"].toInt();
+            line.matrixNum1 = lineObj["matrixNum1"].toInt();
+            line.x1 = lineObj["x1"].toInt();
+            line.y1 = lineObj["y1"].toInt();
+            line.matrixNum2 = lineObj["matrixNum2"].toInt();
+            line.x2 = lineObj["x2"].toInt();
+            line.y2 = lineObj["y2"].toInt();
+            lines.append(line);
+        }
+    }
+    QCOMPARE(lines.size(), array.size());
+    QCOMPARE(lines.last().y2, 700);
+}
+
+void BenchProtocol::addBase64Rows()
+{
+    QTest::addColumn<int>("encodedBytes");
+
+    QTest::newRow("1MB") << 1024 * 1024;
+    QTest::newRow("2MB") << 2 * 1024 * 1024;
+    QTest::newRow("5MB") << 5 * 1024 * 1024;
+}
+
+QByteArray BenchProtocol::base64ImageElement(int encodedBytes, bool lineWrapped)
+{
+    QByteArray raw(encodedBytes / 4 * 3, Qt::Uninitialized);
+    QRandomGenerator rng(23);
+    for (char &byte : raw) {
+        byte = static_cast<char>(rng.generate() & 0xFF);
+    }
+
+    QByteArray encoded = raw.toBase64();
+    if (lineWrapped) {
+        // MIME 방식 76자 줄바꿈 (JSON 문자열 안의 \r\n 이스케이프)
+        QByteArray wrapped;
+        wrapped.reserve(encoded.size() + encoded.size() / 76 * 4);
+        for (qsizetype offset = 0; offset < encoded.size(); offset += 76) {
+            wrapped += encoded.mid(offset, 76);
+            wrapped += "\\r\\n";
+        }
+        encoded = wrapped;
+    }
+    return "{\"timestamp\":\"2025-01-01T00:00:00\",\"image\":\"data:image/jpeg;base64," + encoded + "\"}";
+}
+
+void BenchProtocol::base64Decoder_data()
+{
+    addBase64Rows();
+}
+
+/**
+ * @brief 현재 경로: 원소 바이트에서 image 값 위치만 찾아 복사 없이 디코딩
+ */
+void BenchProtocol::base64Decoder()
+{
+    QFETCH(int, encodedBytes);
+    const QByteArray element = base64ImageElement(encodedBytes, false);
+    qInfo("[Bench] base64 backend: %s", Base64Decoder::backendName());
+
+    QByteArray imageBytes;
+    QBENCHMARK {
+        qsizetype start = 0;
+        qsizetype end = 0;
+        QVERIFY(ImageStreamDecoder::findStringValue(element, "image", start, end));
+        const QByteArrayView payload = Base64Decoder::stripDataUrlPrefix(QByteArrayView(element).sliced(start, end - start));
+        QVERIFY(Base64Decoder::decode(payload, imageBytes));
+    }
+    QCOMPARE(imageBytes.size(), qsizetype(encodedBytes / 4 * 3));
+}
+
+void BenchProtocol::base64DecoderLenient_data()
+{
+    addBase64Rows();
+}
+
+/**
+ * @brief 현재 경로의 관대한 디코딩 (줄바꿈된 본문, 정규화 후 디코딩)
+ */
+void BenchProtocol::base64DecoderLenient()
+{
+    QFETCH(int, encodedBytes);
+    const QByteArray element = base64ImageElement(encodedBytes, true);
+
+    QByteArray imageBytes;
+    QBENCHMARK {
+        qsizetype start = 0;
+        qsizetype end = 0;
+        QVERIFY(ImageStreamDecoder::findStringValue(element, "image", start, end));
+        const QByteArrayView payload = Base64Decoder::stripDataUrlPrefix(QByteArrayView(element).sliced(start, end - start));
+        QVERIFY(Base64Decoder::decodeLenient(payload, imageBytes));
+    }
+    QCOMPARE(imageBytes.size(), qsizetype(encodedBytes / 4 * 3));
+}
+
+void BenchProtocol::base64QStringChain_data()
+{
+    addBase64Rows();
+}
+
+/**
+ * @brief 이전 경로: JSON 파싱 -> QString(UTF-16) -> split(",").last() -> toUtf8() -> fromBase64
+ */
+void BenchProtocol::base64QStringChain()
+{
+    QFETCH(int, encodedBytes);
+    const QByteArray element = base64ImageElement(encodedBytes, false);
+
+    QByteArray imageBytes;
+    QBENCHMARK {
+        const QJsonObject imageObj = QJsonDocument::fromJson(element).object();
+        const QString base64Data = imageObj["image"].toString();
+        imageBytes = QByteArray::fromBase64(base64Data.split(",").last().toUtf8());
+    }
+    QCOMPARE(imageBytes.size(), qsizetype(encodedBytes / 4 * 3));
+}
+
+void BenchProtocol::tlsHandshake_data()
+{
+    QTest::addColumn<bool>("resume");
+
+    QTest::newRow("full handshake") << false;
+    QTest::newRow("resumed with cached ticket") << true;
+}
+
+/**
+ * @brief TLS 연결 시간: 전체 핸드셰이크 vs 캐시한 세션 티켓 제시 (TCP 연결 포함, 두 행의 차이가 절감분)
+ */
+void BenchProtocol::tlsHandshake()
+{
+    QFETCH(bool, resume);
+
+    const QString endpoint = qEnvironmentVariable("CCTV_TLS_BENCH_HOST");
+    const qsizetype colon = endpoint.lastIndexOf(':');
+    if (colon <= 0) {
+        QSKIP("CCTV_TLS_BENCH_HOST=host:port 가 없어 건너뜀");
+    }
+    const QString host = endpoint.left(colon);
+    const quint16 port = endpoint.mid(colon + 1).toUShort();
+
+    // 앱과 같은 설정 (세션 유지 허용, 인증서 검증 생략)
+    QSslConfiguration configuration = QSslConfiguration::defaultConfiguration();
+    configuration.setSslOption(QSsl::SslOptionDisableSessionPersistence, false);
+    configuration.setPeerVerifyMode(QSslSocket::VerifyNone);
+
+    QByteArray ticket;
+    if (resume) {
+        ticket = fetchSessionTicket(host, port, configuration);
+        if (ticket.isEmpty()) {
+            QSKIP("서버가 세션 티켓을 보내지 않아 재사용을 측정할 수 없음");
+        }
+    }
+
+    QBENCHMARK {
+        QSslConfiguration attempt = configuration;
+        attempt.setSessionTicket(ticket);
+        QSslSocket socket;
+        socket.setSslConfiguration(attempt);
+        socket.connectToHostEncrypted(host, port);
+        QVERIFY2(socket.waitForEncrypted(5000), qPrintable(socket.errorString()));
+
+        // 앱처럼 서버가 새로 준 티켓이 있으면 다음 연결에 사용
+        const QByteArray next = socket.sslConfiguration().sessionTicket();
+        if (resume && !next.isEmpty()) {
+            ticket = next;
+        }
+        socket.abort();
+    }
+}
+
+QByteArray BenchProtocol::fetchSessionTicket(const QString &host, quint16 port, const QSslConfiguration &configuration)
+{
+    QSslSocket socket;
+    socket.setSslConfiguration(configuration);
+    socket.connectToHostEncrypted(host, port);
+    if (!socket.waitForEncrypted(5000)) {
+        qWarning("[Bench] TLS 연결 실패: %s", qPrintable(socket.errorString()));
+        return QByteArray();
+    }
+
+    // TLS 1.3은 핸드셰이크 뒤에 티켓을 보내므로 잠시 기다림
+    if (socket.sslConfiguration().sessionTicket().isEmpty()) {
+        QSignalSpy ticketSpy(&socket, &QSslSocket::newSessionTicketReceived);
+        ticketSpy.wait(2000);
+    }
+    const QByteArray ticket = socket.sslConfiguration().sessionTicket();
+    socket.abort();
+    return ticket;
+}
+
+QTEST_GUILESS_MAIN(BenchProtocol)
+#include "bench_protocol.moc"
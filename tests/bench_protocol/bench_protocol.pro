@@ -0,0 +1,25 @@
+QT = core network testlib
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+TARGET = bench_protocol
+TEMPLATE = app
+
+# 측정 대상 소스 (앱과 같은 파일을 그대로 빌드)
+INCLUDEPATH += $$PWD/../..
+
+SOURCES += \
+    bench_protocol.cpp \
+    $$PWD/../../ChunkedRingBuffer.cpp \
+    $$PWD/../../ObjectClass.cpp \
+    $$PWD/../../Base64Decoder.cpp \
+    $$PWD/../../ImageStreamDecoder.cpp
+
+# TcpCommunicator.h는 메시지 구조체와 필드 설명만 사용 (클래스 자체는 빌드하지 않음)
+HEADERS += \
+    $$PWD/../../ChunkedRingBuffer.h \
+    $$PWD/../../ObjectClass.h \
+    $$PWD/../../MessageFields.h \
+    $$PWD/../../Base64Decoder.h \
+    $$PWD/../../ImageStreamDecoder.h
@@ -0,0 +1,6 @@
+# 단위 테스트/벤치마크 (앱과 별도로 빌드: qmake tests/tests.pro && make && make check)
+TEMPLATE = subdirs
+
+SUBDIRS += \
+    tst_framecodec \
+    bench_protocol
@@ -0,0 +1,434 @@
+#include <QRandomGenerator>
+#include <QtEndian>
+#include <QtTest>
+#include <cstdio>
+
+#include "FrameCodec.h"
+#include "ImageStreamDecoder.h"
+
+/**
+ * @brief FrameCodec 단위 테스트 및 처리량 벤치마크
+ * @details 소켓 없이 임의로 자른 바이트 조각을 feed()에 넣어 세 수신 경로(일반, 스트리밍, 임시 파일)와
+ *          오류 처리를 확인합니다. 벤치마크는 작은 BBox 프레임과 큰 이미지 응답의 처리량을 잽니다.
+ */
+class TestFrameCodec : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    void randomChunkSplits_data();
+    void randomChunkSplits();
+    void compressedFlag();
+    void oversizedHeader();
+    void corruptHeaderStopsDecoding();
+    void compressedFrameOverMemoryLimit();
+    void streamingImageResponse();
+    void streamingNonImageFrame();
+    void spilledImageResponse();
+    void spilledNonStreamableFrame();
+    void resetInsideHandler();
+    void topLevelProbes();
+
+    void benchmarkBBoxFrames();
+    void benchmarkLargeImageResponse();
+
+private:
+    /** @brief 처리기가 받은 결과 */
+    struct Received {
+        QList<QByteArray> frames;
+        QList<bool> compressed;
+        QList<QByteArray> elements;
+        QList<QJsonObject> finishedFields;
+        QStringList errors;
+    };
+
+    /** @brief 처리기를 모두 Received에 연결 */
+    static void attach(FrameCodec &codec, Received &received);
+    /** @brief 바이트 스트림을 임의 크기 조각으로 나눠 입력 */
+    static int feedInRandomChunks(FrameCodec &codec, const QByteArray &stream, quint32 seed, int maxChunk);
+    /** @brief 작은 BBox 메시지 (request_id 200) */
+    static QByteArray bboxMessage(int index);
+    /** @brief 이미지 응답 (request_id 10) */
+    static QByteArray imageResponse(int seq, int count, int imageBytes);
+};
+
+/**
+ * @brief 프레임마다 찍히는 qDebug 로그를 끄기 (벤치마크 측정값 왜곡 방지)
+ */
+void TestFrameCodec::initTestCase()
+{
+    qInstallMessageHandler([](QtMsgType type, const QMessageLogContext &, const QString &message) {
+        if (type != QtDebugMsg) {
+            fprintf(stderr, "%s\n", qPrintable(message));
+        }
+    });
+}
+
+void TestFrameCodec::attach(FrameCodec &codec, Received &received)
+{
+    codec.setFrameHandler([&received](const QByteArray &payload, bool compressed) {
+        received.frames.append(payload);
+        received.compressed.append(compressed);
+    });
+    codec.setImageElementsHandler([&received](const QList<QByteArray> &elements) {
+        received.elements.append(elements);
+    });
+    codec.setImageStreamFinishedHandler([&received](const QJsonObject &fields, int) {
+        received.finishedFields.append(fields);
+    });
+    codec.setErrorHandler([&received](const QString &error) {
+        received.errors.append(error);
+    });
+}
+
+int TestFrameCodec::feedInRandomChunks(FrameCodec &codec, const QByteArray &stream, quint32 seed, int maxChunk)
+{
+    QRandomGenerator rng(seed);
+    int frames = 0;
+    qsizetype offset = 0;
+    while (offset < stream.size()) {
+        const qsizetype length = qMin<qsizetype>(rng.bounded(1, maxChunk + 1), stream.size() - offset);
+        frames += codec.feed(stream.mid(offset, length));
+        offset += length;
+    }
+    return frames;
+}
+
+QByteArray TestFrameCodec::bboxMessage(int index)
+{
+    return "{\"request_id\":200,\"camera_id\":\"cam01\",\"timestamp\":" + QByteArray::number(1735700000000LL + index * 33)
+           + ",\"frame_seq\":" + QByteArray::number(index) + ",\"bboxes\":[{\"id\":" + QByteArray::number(index)
+           + ",\"type\":\"person\",\"confidence\":0.9,\"x\":10,\"y\":20,\"width\":30,\"height\":40}]}";
+}
+
+QByteArray TestFrameCodec::imageResponse(int seq, int count, int imageBytes)
+{
+    QByteArray json = "{\"request_id\":10,\"seq\":" + QByteArray::number(seq) + ",\"data\":[";
+    for (int i = 0; i < count; ++i) {
+        if (i > 0) {
+            json += ',';
+        }
+        json += "{\"image_id\":\"img" + QByteArray::number(i) + "\",\"timestamp\":\"2025-01-01T00:00:"
+                + QByteArray::number(10 + i % 50) + "\",\"image\":\"" + QByteArray(imageBytes, 'A') + "\"}";
+    }
+    json += "],\"next_cursor\":\"c1\"}";
+    return json;
+}
+
+void TestFrameCodec::randomChunkSplits_data()
+{
+    QTest::addColumn<quint32>("seed");
+    QTest::addColumn<int>("maxChunk");
+
+    QTest::newRow("byte-by-byte") << 1u << 1;
+    QTest::newRow("header-sized") << 2u << 5;
+    QTest::newRow("small") << 3u << 97;
+    QTest::newRow("socket-sized") << 4u << 64 * 1024;
+    QTest::newRow("large") << 5u << 1024 * 1024;
+}
+
+/**
+ * @brief 조각 경계와 무관하게 같은 프레임/원소가 같은 순서로 나오는지 확인
+ */
+void TestFrameCodec::randomChunkSplits()
+{
+    QFETCH(quint32, seed);
+    QFETCH(int, maxChunk);
+
+    // 일반 프레임 사이에 스트리밍 기준을 넘는 이미지 응답을 끼움
+    QList<QByteArray> messages;
+    for (int i = 0; i < 20; ++i) {
+        messages.append(bboxMessage(i));
+    }
+    messages.insert(10, imageResponse(7, 8, 48 * 1024));
+
+    QByteArray stream;
+    for (const QByteArray &message : messages) {
+        stream += FrameCodec::encode(message);
+    }
+
+    FrameCodec codec;
+    Received received;
+    attach(codec, received);
+
+    QCOMPARE(feedInRandomChunks(codec, stream, seed, maxChunk), messages.size());
+    QVERIFY(received.errors.isEmpty());
+    QCOMPARE(codec.bufferedBytes(), qint64(0));
+
+    messages.removeAt(10);
+    QCOMPARE(received.frames, messages);
+    QCOMPARE(received.elements.size(), 8);
+    for (const QByteArray &element : received.elements) {
+        QVERIFY(element.startsWith("{\"image_id\""));
+        QVERIFY(element.endsWith("\"}"));
+    }
+    QCOMPARE(received.finishedFields.size(), 1);
+    QCOMPARE(received.finishedFields.first()["seq"].toInt(), 7);
+    QCOMPARE(received.finishedFields.first()["next_cursor"].toString(), QString("c1"));
+}
+
+/**
+ * @brief 압축 표시 비트가 처리기에 전달되고 길이에서 제외되는지 확인
+ */
+void TestFrameCodec::compressedFlag()
+{
+    const QByteArray message = bboxMessage(1);
+    const QByteArray stream = FrameCodec::encode(qCompress(message), true) + FrameCodec::encode(message);
+
+    FrameCodec codec;
+    Received received;
+    attach(codec, received);
+
+    QCOMPARE(feedInRandomChunks(codec, stream, 11, 7), 2);
+    QCOMPARE(received.compressed, QList<bool>({true, false}));
+    QCOMPARE(qUncompress(received.frames.at(0)), message);
+    QCOMPARE(received.frames.at(1), message);
+}
+
+/**
+ * @brief 절대 상한을 넘는 길이 헤더는 할당 없이 오류로 처리
+ */
+void TestFrameCodec::oversizedHeader()
+{
+    FrameCodec codec;
+    codec.setLimits(1024 * 1024, 4 * 1024 * 1024);
+    Received received;
+    attach(codec, received);
+
+    QByteArray header(4, '\0');
+    qToBigEndian<quint32>(64 * 1024 * 1024, header.data());
+
+    QCOMPARE(codec.feed(header + QByteArray(1024, 'x')), 0);
+    QVERIFY(codec.hasError());
+    QCOMPARE(received.errors.size(), 1);
+    QVERIFY(received.errors.first().startsWith("Frame too large"));
+}
+
+/**
+ * @brief 손상된 헤더 이후로는 reset() 전까지 디코딩하지 않고, reset() 후에는 다시 받음
+ */
+void TestFrameCodec::corruptHeaderStopsDecoding()
+{
+    FrameCodec codec;
+    codec.setLimits(1024 * 1024, 4 * 1024 * 1024);
+    Received received;
+    attach(codec, received);
+
+    // 텍스트가 길이 헤더 자리에 들어온 경우 ("{\"re" = 0x7B227265)
+    QCOMPARE(codec.feed(bboxMessage(0) + FrameCodec::encode(bboxMessage(1))), 0);
+    QVERIFY(codec.hasError());
+    QCOMPARE(received.errors.size(), 1);
+
+    QCOMPARE(codec.feed(FrameCodec::encode(bboxMessage(2))), 0);
+    QVERIFY(received.frames.isEmpty());
+
+    codec.reset();
+    QVERIFY(!codec.hasError());
+    QCOMPARE(codec.feed(FrameCodec::encode(bboxMessage(3))), 1);
+    QCOMPARE(received.frames, QList<QByteArray>({bboxMessage(3)}));
+}
+
+/**
+ * @brief 메모리 상한을 넘는 압축 프레임은 본문을 받기 전에 거부
+ */
+void TestFrameCodec::compressedFrameOverMemoryLimit()
+{
+    FrameCodec codec;
+    codec.setLimits(64 * 1024, 4 * 1024 * 1024);
+    Received received;
+    attach(codec, received);
+
+    QByteArray header(4, '\0');
+    qToBigEndian<quint32>((128 * 1024) | FrameCompressedFlag, header.data());
+
+    QCOMPARE(codec.feed(header), 0);
+    QVERIFY(codec.hasError());
+    QCOMPARE(received.errors.size(), 1);
+    QVERIFY(received.errors.first().startsWith("Compressed frame too large"));
+}
+
+/**
+ * @brief 스트리밍 기준 이상의 이미지 응답은 원소가 도착하는 대로 나옴
+ */
+void TestFrameCodec::streamingImageResponse()
+{
+    const QByteArray message = imageResponse(3, 4, 128 * 1024);
+    const QByteArray frame = FrameCodec::encode(message);
+
+    FrameCodec codec;
+    Received received;
+    attach(codec, received);
+
+    // 첫 두 원소 분량까지만 넣어도 원소가 먼저 나와야 함
+    const qsizetype firstPart = message.indexOf("{\"image_id\":\"img2\"") + 4;
+    QCOMPARE(codec.feed(frame.left(firstPart)), 0);
+    QCOMPARE(received.elements.size(), 2);
+    QVERIFY(received.finishedFields.isEmpty());
+
+    QCOMPARE(codec.feed(frame.mid(firstPart)), 1);
+    QCOMPARE(received.elements.size(), 4);
+    QCOMPARE(received.finishedFields.size(), 1);
+    QCOMPARE(received.finishedFields.first()["seq"].toInt(), 3);
+    QVERIFY(received.frames.isEmpty());
+}
+
+/**
+ * @brief 스트리밍 기준 이상이지만 이미지 응답이 아닌 프레임은 전체가 일반 처리기로 나옴
+ */
+void TestFrameCodec::streamingNonImageFrame()
+{
+    const QByteArray message = "{\"request_id\":12,\"data\":\"" + QByteArray(300 * 1024, 'x') + "\"}";
+
+    FrameCodec codec;
+    Received received;
+    attach(codec, received);
+
+    QCOMPARE(feedInRandomChunks(codec, FrameCodec::encode(message), 21, 32 * 1024), 1);
+    QCOMPARE(received.frames, QList<QByteArray>({message}));
+    QVERIFY(received.elements.isEmpty());
+}
+
+/**
+ * @brief 메모리 상한을 넘는 이미지 응답은 임시 파일을 거쳐 원소 단위로 나오고, 원소 상한을 넘는 원소는 건너뜀
+ */
+void TestFrameCodec::spilledImageResponse()
+{
+    FrameCodec codec;
+    codec.setLimits(256 * 1024, 16 * 1024 * 1024);
+    Received received;
+    attach(codec, received);
+    int skipped = -1;
+    codec.setImageStreamFinishedHandler([&received, &skipped](const QJsonObject &fields, int skippedElements) {
+        received.finishedFields.append(fields);
+        skipped = skippedElements;
+    });
+
+    // 16 x 64KB 원소 + 메모리 상한을 넘는 원소 하나
+    QByteArray message = imageResponse(9, 16, 64 * 1024);
+    const QByteArray oversized = ",{\"image_id\":\"big\",\"timestamp\":\"2025-01-01T00:01:00\",\"image\":\""
+                                 + QByteArray(512 * 1024, 'B') + "\"}";
+    message.insert(message.lastIndexOf(']'), oversized);
+
+    QCOMPARE(feedInRandomChunks(codec, FrameCodec::encode(message), 31, 200 * 1024), 1);
+    QVERIFY(received.errors.isEmpty());
+    QCOMPARE(received.elements.size(), 16);
+    QCOMPARE(skipped, 1);
+    QCOMPARE(received.finishedFields.size(), 1);
+    QCOMPARE(received.finishedFields.first()["seq"].toInt(), 9);
+    QVERIFY(received.frames.isEmpty());
+
+    // 임시 파일 프레임 뒤의 일반 프레임도 이어서 받음
+    QCOMPARE(codec.feed(FrameCodec::encode(bboxMessage(1))), 1);
+    QCOMPARE(received.frames, QList<QByteArray>({bboxMessage(1)}));
+}
+
+/**
+ * @brief 메모리 상한을 넘지만 원소 단위로 나눌 수 없는 프레임은 전체를 올리지 않고 오류
+ */
+void TestFrameCodec::spilledNonStreamableFrame()
+{
+    FrameCodec codec;
+    codec.setLimits(64 * 1024, 16 * 1024 * 1024);
+    Received received;
+    attach(codec, received);
+
+    const QByteArray message = "{\"request_id\":12,\"data\":\"" + QByteArray(512 * 1024, 'x') + "\"}";
+
+    feedInRandomChunks(codec, FrameCodec::encode(message), 41, 16 * 1024);
+    QVERIFY(codec.hasError());
+    QCOMPARE(received.errors.size(), 1);
+    QVERIFY(received.errors.first().startsWith("Frame too large to decode"));
+    QVERIFY(received.frames.isEmpty());
+}
+
+/**
+ * @brief 처리기 안에서 reset()하면 같은 조각의 남은 프레임은 버림
+ */
+void TestFrameCodec::resetInsideHandler()
+{
+    FrameCodec codec;
+    QList<QByteArray> frames;
+    codec.setFrameHandler([&codec, &frames](const QByteArray &payload, bool) {
+        frames.append(payload);
+        codec.reset();
+    });
+
+    const QByteArray stream = FrameCodec::encode(bboxMessage(0)) + FrameCodec::encode(bboxMessage(1));
+    codec.feed(stream);
+    QCOMPARE(frames, QList<QByteArray>({bboxMessage(0)}));
+    QCOMPARE(codec.bufferedBytes(), qint64(0));
+}
+
+/**
+ * @brief 파싱 없이 최상위 메시지 ID와 문자열 값 위치 찾기
+ */
+void TestFrameCodec::topLevelProbes()
+{
+    QCOMPARE(ImageStreamDecoder::findMessageId(bboxMessage(0)), 200);
+    QCOMPARE(ImageStreamDecoder::findMessageId(R"({"data":{"request_id":71},"response_id": 71})"), 71);
+    QCOMPARE(ImageStreamDecoder::findMessageId(R"({"note":"request_id","x":1})"), 0);
+
+    const QByteArray message = R"({"request_id":71,"meta":{"image":"nested"},"image" : "a\"b","seq":3})";
+    qsizetype start = 0;
+    qsizetype end = 0;
+    QVERIFY(ImageStreamDecoder::findStringValue(message, "image", start, end));
+    QCOMPARE(message.mid(start, end - start), QByteArray(R"(a\"b)"));
+    QVERIFY(!ImageStreamDecoder::findStringValue(message, "seq", start, end));
+}
+
+/**
+ * @brief 작은 BBox 프레임 처리량 (1000 프레임, 소켓 크기 조각)
+ */
+void TestFrameCodec::benchmarkBBoxFrames()
+{
+    QByteArray stream;
+    for (int i = 0; i < 1000; ++i) {
+        stream += FrameCodec::encode(bboxMessage(i));
+    }
+    QList<QByteArray> chunks;
+    for (qsizetype offset = 0; offset < stream.size(); offset += 16 * 1024) {
+        chunks.append(stream.mid(offset, 16 * 1024));
+    }
+
+    FrameCodec codec;
+    qint64 bytes = 0;
+    codec.setFrameHandler([&bytes](const QByteArray &payload, bool) { bytes += payload.size(); });
+
+    QBENCHMARK {
+        int frames = 0;
+        for (const QByteArray &chunk : chunks) {
+            frames += codec.feed(chunk);
+        }
+        QCOMPARE(frames, 1000);
+    }
+    QVERIFY(bytes > 0);
+}
+
+/**
+ * @brief 큰 이미지 응답 처리량 (약 8MB, 64KB 조각, 스트리밍 경로)
+ */
+void TestFrameCodec::benchmarkLargeImageResponse()
+{
+    const QByteArray stream = FrameCodec::encode(imageResponse(1, 40, 200 * 1024));
+    QList<QByteArray> chunks;
+    for (qsizetype offset = 0; offset < stream.size(); offset += 64 * 1024) {
+        chunks.append(stream.mid(offset, 64 * 1024));
+    }
+
+    FrameCodec codec;
+    int elements = 0;
+    codec.setImageElementsHandler([&elements](const QList<QByteArray> &list) { elements += list.size(); });
+
+    QBENCHMARK {
+        elements = 0;
+        for (const QByteArray &chunk : chunks) {
+            codec.feed(chunk);
+        }
+        QCOMPARE(elements, 40);
+    }
+}
+
+QTEST_GUILESS_MAIN(TestFrameCodec)
+#include "tst_framecodec.moc"
@@ -0,0 +1,23 @@
+QT = core testlib
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+TARGET = tst_framecodec
+TEMPLATE = app
+
+# 테스트 대상 소스 (앱과 같은 파일을 그대로 빌드)
+INCLUDEPATH += $$PWD/../..
+
+SOURCES += \
+    tst_framecodec.cpp \
+    $$PWD/../../FrameCodec.cpp \
+    $$PWD/../../ChunkedRingBuffer.cpp \
+    $$PWD/../../ImageStreamDecoder.cpp \
+    $$PWD/../../FrameSpillFile.cpp
+
+HEADERS += \
+    $$PWD/../../FrameCodec.h \
+    $$PWD/../../ChunkedRingBuffer.h \
+    $$PWD/../../ImageStreamDecoder.h \
+    $$PWD/../../FrameSpillFile.h